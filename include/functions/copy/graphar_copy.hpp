@@ -0,0 +1,123 @@
+#pragma once
+
+#include <duckdb/common/types/column/column_data_collection.hpp>
+#include <duckdb/function/copy_function.hpp>
+#include <duckdb/main/extension/extension_loader.hpp>
+
+#include <arrow/api.h>
+
+#include <graphar/arrow/chunk_writer.h>
+#include <graphar/graph_info.h>
+
+#include <mutex>
+
+namespace duckdb {
+
+// COPY ... TO 'dir' (FORMAT graphar, vertex_type ...) writes the rows as the vertices of a type, in row order;
+// COPY ... TO 'dir' (FORMAT graphar, edge_type ..., src_type ..., dst_type ...) writes them as edges whose first two
+// columns are the GraphAr ids of their source and destination vertices, which must already be in the graph.
+// Either adds the type to the graph yaml of the directory, creating it if needed. With sorted_by 'src' or 'dst' the
+// edges arrive sorted by that id, e.g. from an ORDER BY, and its adjacency list is streamed to the files.
+class GraphArCopyBindData final : public FunctionData {
+public:
+    bool IsEdges() const { return !edge_type.empty(); }
+
+    unique_ptr<FunctionData> Copy() const override { return make_uniq<GraphArCopyBindData>(*this); }
+    bool Equals(const FunctionData& other_p) const override {
+        auto& other = other_p.Cast<GraphArCopyBindData>();
+        return vertex_type == other.vertex_type && edge_type == other.edge_type && src_type == other.src_type &&
+               dst_type == other.dst_type && chunk_size == other.chunk_size && graph_name == other.graph_name &&
+               presorted == other.presorted && primary_key == other.primary_key && names == other.names &&
+               types == other.types;
+    }
+
+    std::string vertex_type;
+    std::string edge_type;
+    std::string src_type;
+    std::string dst_type;
+    idx_t chunk_size = 0;
+    std::string graph_name = "graph";
+    // vertex property marked as the primary key, if any
+    std::string primary_key;
+    bool directed = true;
+    vector<graphar::AdjListType> adj_list_types;
+    // the input is sorted by the id of the only adjacency list
+    bool presorted = false;
+    // names and types of the written columns; the ids of edges are BIGINT
+    vector<std::string> names;
+    vector<LogicalType> types;
+};
+
+// Edges of one ordered adjacency list, partitioned by the vertex chunk of the side it is ordered by
+struct GraphArCopyAdjList {
+    graphar::AdjListType type;
+    idx_t id_column;
+    idx_t vertex_count;
+    idx_t vertex_chunk_size;
+    std::shared_ptr<graphar::EdgeChunkWriter> writer;
+    // per vertex chunk, the collections the threads filled
+    vector<vector<unique_ptr<ColumnDataCollection>>> partitions;
+};
+
+class GraphArCopyGlobalState final : public GlobalFunctionData {
+public:
+    std::string directory;
+    std::shared_ptr<graphar::GraphInfo> graph_info;
+    std::shared_ptr<arrow::Schema> schema;
+    std::mutex lock;
+
+    // rows are cut into chunks in order, the last partial chunk waits for the next rows
+    vector<std::shared_ptr<arrow::RecordBatch>> pending;
+    idx_t pending_rows = 0;
+    idx_t chunk_index = 0;
+
+    // vertices
+    std::shared_ptr<graphar::VertexInfo> vertex_info;
+    std::shared_ptr<graphar::VertexPropertyWriter> vertex_writer;
+    idx_t vertex_count = 0;
+
+    // edges
+    std::shared_ptr<graphar::EdgeInfo> edge_info;
+    vector<GraphArCopyAdjList> adj_lists;
+
+    // presorted edges: the vertex chunk being written, with the degrees of its vertices so far
+    int64_t vertex_chunk = -1;
+    int64_t last_id = -1;
+    idx_t edge_count = 0;
+    vector<int64_t> degrees;
+};
+
+class GraphArCopyLocalState final : public LocalFunctionData {
+public:
+    // per adjacency list and vertex chunk, the edges this thread sank
+    vector<vector<unique_ptr<ColumnDataCollection>>> partitions;
+};
+
+class GraphArCopyPreparedBatch final : public PreparedBatchData {
+public:
+    std::shared_ptr<arrow::Table> table;
+};
+
+struct GraphArCopy {
+    static unique_ptr<FunctionData> Bind(ClientContext& context, CopyFunctionBindInput& input,
+                                         const vector<string>& names, const vector<LogicalType>& sql_types);
+    static unique_ptr<GlobalFunctionData> InitGlobal(ClientContext& context, FunctionData& bind_data,
+                                                     const string& file_path);
+    static unique_ptr<LocalFunctionData> InitLocal(ExecutionContext& context, FunctionData& bind_data);
+    static void Sink(ExecutionContext& context, FunctionData& bind_data, GlobalFunctionData& gstate,
+                     LocalFunctionData& lstate, DataChunk& input);
+    static void Combine(ExecutionContext& context, FunctionData& bind_data, GlobalFunctionData& gstate,
+                        LocalFunctionData& lstate);
+    static void Finalize(ClientContext& context, FunctionData& bind_data, GlobalFunctionData& gstate);
+    static CopyFunctionExecutionMode ExecutionMode(bool preserve_insertion_order, bool supports_batch_index);
+    static unique_ptr<PreparedBatchData> PrepareBatch(ClientContext& context, FunctionData& bind_data,
+                                                      GlobalFunctionData& gstate,
+                                                      unique_ptr<ColumnDataCollection> collection);
+    static void FlushBatch(ClientContext& context, FunctionData& bind_data, GlobalFunctionData& gstate,
+                           PreparedBatchData& batch);
+    static idx_t DesiredBatchSize(ClientContext& context, FunctionData& bind_data);
+
+    static void Register(ExtensionLoader& loader);
+    static CopyFunction GetFunction();
+};
+}  // namespace duckdb
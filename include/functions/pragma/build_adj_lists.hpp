@@ -0,0 +1,16 @@
+#pragma once
+
+#include <duckdb/function/pragma_function.hpp>
+#include <duckdb/main/extension/extension_loader.hpp>
+
+namespace duckdb {
+
+// PRAGMA graphar_build_adj_lists('dir', 'edges', 'edge_type', 'src_type'[, dst_type := ..., chunk_size := ...]) writes
+// both ordered adjacency lists of an edge table or view. It expands to one COPY TO graphar per list, whose ORDER BY
+// runs as DuckDB's parallel sort, spilling to the temp directory, and whose output is streamed with sorted_by.
+struct BuildAdjLists {
+    static string Query(ClientContext& context, const FunctionParameters& parameters);
+    static void Register(ExtensionLoader& loader);
+    static PragmaFunction GetFunction();
+};
+}  // namespace duckdb
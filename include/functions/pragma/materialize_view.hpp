@@ -0,0 +1,17 @@
+#pragma once
+
+#include <duckdb/function/pragma_function.hpp>
+#include <duckdb/main/extension/extension_loader.hpp>
+
+namespace duckdb {
+
+// PRAGMA graphar_materialize('graph', 'view') stores the rows of a view of an attached graph in the DuckDB database
+// next to the graph yaml, which it attaches as <graph>_cache. The table is named after the view and a fingerprint of
+// the graph files and the view query, so the view reads it until the graph changes and runs its query again after;
+// calling the pragma again refreshes it and drops the older tables of the view.
+struct MaterializeView {
+    static string Query(ClientContext& context, const FunctionParameters& parameters);
+    static void Register(ExtensionLoader& loader);
+    static PragmaFunction GetFunction();
+};
+}  // namespace duckdb
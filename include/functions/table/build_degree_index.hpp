@@ -0,0 +1,37 @@
+#pragma once
+
+#include <duckdb/function/table_function.hpp>
+#include <duckdb/main/extension/extension_loader.hpp>
+
+#include <graphar/graph_info.h>
+
+namespace duckdb {
+
+class BuildDegreeIndexBindData final : public TableFunctionData {
+public:
+    BuildDegreeIndexBindData(std::shared_ptr<graphar::EdgeInfo> edge_info, std::string prefix)
+        : edge_info(edge_info), prefix(prefix) {};
+
+    const std::shared_ptr<graphar::EdgeInfo>& GetEdgeInfo() const { return edge_info; }
+    const std::string& GetPrefix() const { return prefix; }
+
+private:
+    std::shared_ptr<graphar::EdgeInfo> edge_info;
+    std::string prefix;
+};
+
+struct BuildDegreeIndexGlobalTableFunctionState : public GlobalTableFunctionState {
+public:
+    static unique_ptr<GlobalTableFunctionState> Init(ClientContext& context, TableFunctionInitInput& input);
+
+    bool finished = false;
+};
+
+struct BuildDegreeIndex {
+    static unique_ptr<FunctionData> Bind(ClientContext& context, TableFunctionBindInput& input,
+                                         vector<LogicalType>& return_types, vector<string>& names);
+    static void Execute(ClientContext& context, TableFunctionInput& data, DataChunk& output);
+    static void Register(ExtensionLoader& loader);
+    static TableFunction GetFunction();
+};
+}  // namespace duckdb
@@ -1,17 +1,33 @@
 #pragma once
 
+#include "utils/degree_index.hpp"
+#include "utils/func.hpp"
+
+#include <arrow/api.h>
+
 #include <duckdb/common/named_parameter_map.hpp>
 #include <duckdb/function/table_function.hpp>
 #include <duckdb/main/extension/extension_loader.hpp>
+#include <duckdb/planner/table_filter.hpp>
 
 #include <graphar/api/high_level_reader.h>
 #include <graphar/graph_info.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace duckdb {
 
 struct EdgesVertex;
 struct EdgesVertexGlobalTableFunctionState;
 
+// One ordered adjacency list whose degrees are added up into a degree column
+struct DegreeSource {
+    std::shared_ptr<graphar::EdgeInfo> edge_info;
+    graphar::AdjListType adj_list_type;
+    idx_t column;
+};
+
 class EdgesVertexBindData final : public TableFunctionData {
 public:
     explicit EdgesVertexBindData(const std::string& file_path) : file_path(file_path) {};
@@ -19,56 +35,130 @@ public:
     const std::string& GetFilePath() const { return file_path; }
     void SetFilePath(const std::string& path) { file_path = path; }
 
+    const std::string& GetPrefix() const { return prefix; }
+    void SetPrefix(const std::string& prefix_) { prefix = prefix_; }
+
     const std::shared_ptr<graphar::GraphInfo>& GetGraphInfo() const { return graph_info; }
     void SetGraphInfo(const std::shared_ptr<graphar::GraphInfo>& info) { graph_info = info; }
 
-    const std::shared_ptr<graphar::EdgeInfo>& GetEdgeInfo() const { return edge_info; }
-    void SetEdgeInfo(const std::shared_ptr<graphar::EdgeInfo>& info) { edge_info = info; }
+    GraphArDirection GetDirection() const { return direction; }
+    void SetDirection(GraphArDirection direction_) { direction = direction_; }
+
+    // Adjacency lists scanned for the degrees: one edge type, or every edge type of a vertex type of the graph
+    const std::vector<DegreeSource>& GetSources() const { return sources; }
+    void AddSource(const std::shared_ptr<graphar::EdgeInfo>& edge_info, graphar::AdjListType adj_list_type,
+                   idx_t column) {
+        sources.push_back({edge_info, adj_list_type, column});
+    }
+    // Number of degree columns; the grapharId column follows them
+    idx_t GetDegreeColumnCount() const { return degree_column_count; }
+    void SetDegreeColumnCount(idx_t count) { degree_column_count = count; }
+    idx_t GetVertexChunkSize() const {
+        return GetAdjListVertexChunkSize(sources[0].edge_info, sources[0].adj_list_type);
+    }
+    // Vertices of the first source, counted when the function is bound
+    std::int64_t GetVertexCount() const { return vertex_count; }
+    void SetVertexCount(std::int64_t count) { vertex_count = count; }
+    // Degree indexes of all sources, opened when the function is bound; empty when some of them is missing or stale
+    const std::vector<unique_ptr<DegreeIndex>>& GetDegreeIndexes() const { return degree_indexes; }
+    void SetDegreeIndexes(std::vector<unique_ptr<DegreeIndex>> indexes) { degree_indexes = std::move(indexes); }
+    // Degrees of the edges inserted since the last checkpoint per degree column and vertex, counted when the function
+    // is bound from the delta chunks; empty for the columns without them
+    const std::vector<std::vector<int64_t>>& GetDeltaDegrees() const { return delta_degrees; }
+    void SetDeltaDegrees(std::vector<std::vector<int64_t>> degrees) { delta_degrees = std::move(degrees); }
 
 private:
     std::string file_path;
+    std::string prefix;
     std::shared_ptr<graphar::GraphInfo> graph_info;
-    std::shared_ptr<graphar::EdgeInfo> edge_info;
+    GraphArDirection direction = GraphArDirection::Out;
+    std::vector<DegreeSource> sources;
+    idx_t degree_column_count = 1;
+    std::int64_t vertex_count = 0;
+    std::vector<unique_ptr<DegreeIndex>> degree_indexes;
+    std::vector<std::vector<int64_t>> delta_degrees;
 
     friend struct EdgesVertex;
     friend struct EdgesVertexGlobalTableFunctionState;
 };
 
+// Vertices [iter, end_iter) are scanned in parallel, one offset chunk of every source per task
 struct EdgesVertexGlobalState {
 public:
-    EdgesVertexGlobalState(ClientContext& context, EdgesVertexBindData& bind_data,
-                           std::shared_ptr<graphar::EdgeInfo> edge_info, const std::string& prefix, idx_t iter,
-                           idx_t end_iter)
-        : edge_info(edge_info), prefix(prefix), iter(iter), end_iter(end_iter) {};
+    EdgesVertexGlobalState(ClientContext& context, const EdgesVertexBindData& bind_data, idx_t iter, idx_t end_iter)
+        : prefix(bind_data.GetPrefix()),
+          sources(bind_data.GetSources()),
+          degree_column_count(bind_data.GetDegreeColumnCount()),
+          iter(iter),
+          end_iter(end_iter),
+          vertex_chunk_size(bind_data.GetVertexChunkSize()),
+          next_chunk(iter / vertex_chunk_size),
+          end_chunk(iter < end_iter ? (end_iter - 1) / vertex_chunk_size + 1 : iter / vertex_chunk_size),
+          degree_filters(degree_column_count),
+          degree_indexes(bind_data.GetDegreeIndexes()),
+          delta_degrees(bind_data.GetDeltaDegrees()) {};
 
-    const std::shared_ptr<graphar::EdgeInfo>& GetEdgeInfo() const { return edge_info; }
     const std::string& GetPrefix() const { return prefix; }
+    const std::vector<DegreeSource>& GetSources() const { return sources; }
+    idx_t GetDegreeColumnCount() const { return degree_column_count; }
     idx_t GetIter() const { return iter; }
     idx_t GetEndIter() const { return end_iter; }
-    idx_t GetChunkCount() const { return chunk_count; }
-
-    void IncrementChunkCount() { ++chunk_count; }
-    void IncrementIter() { ++iter; }
+    idx_t GetVertexChunkSize() const { return vertex_chunk_size; }
+    idx_t GetChunkNum() const { return end_chunk - iter / vertex_chunk_size; }
+
+    // Pushed down filters on the degree and grapharId columns, evaluated exactly by the scan
+    optional_ptr<const TableFilter> GetDegreeFilter(idx_t column) const { return degree_filters[column]; }
+    optional_ptr<const TableFilter> GetGidFilter() const { return gid_filter; }
+    bool HasDegreeFilter() const {
+        return std::any_of(degree_filters.begin(), degree_filters.end(),
+                           [](const auto& filter) { return static_cast<bool>(filter); });
+    }
+    void SetDegreeFilter(idx_t column, optional_ptr<const TableFilter> filter) { degree_filters[column] = filter; }
+    void SetGidFilter(optional_ptr<const TableFilter> filter) { gid_filter = filter; }
+
+    // Stamps validating the cached degree summaries of a degree column, taken once per scan with degree filters
+    const std::vector<FileStamp>& GetSummaryStamps(idx_t column) const { return summary_stamps[column]; }
+    void SetSummaryStamps(std::vector<std::vector<FileStamp>> stamps) { summary_stamps = std::move(stamps); }
+
+    // Degree indexes of all sources of the scan, owned by the bind data
+    const std::vector<unique_ptr<DegreeIndex>>& GetDegreeIndexes() const { return degree_indexes; }
+    // Degrees of the inserted edges not merged yet, owned by the bind data
+    const std::vector<std::vector<int64_t>>& GetDeltaDegrees() const { return delta_degrees; }
+
+    // Claims the next offset chunk to scan; returns false when all of them are taken
+    bool NextChunk(idx_t& chunk_index) {
+        chunk_index = next_chunk++;
+        return chunk_index < end_chunk;
+    }
 
 private:
-    std::shared_ptr<graphar::EdgeInfo> edge_info;
     std::string prefix;
+    std::vector<DegreeSource> sources;
+    idx_t degree_column_count;
     idx_t iter;
     idx_t end_iter;
-    idx_t chunk_count = 0;
+    idx_t vertex_chunk_size;
+    std::atomic<idx_t> next_chunk;
+    idx_t end_chunk;
+    std::vector<optional_ptr<const TableFilter>> degree_filters;
+    optional_ptr<const TableFilter> gid_filter;
+    std::vector<std::vector<FileStamp>> summary_stamps;
+    const std::vector<unique_ptr<DegreeIndex>>& degree_indexes;
+    const std::vector<std::vector<int64_t>>& delta_degrees;
 
     friend struct EdgesVertex;
 };
 
 struct EdgesVertexGlobalTableFunctionState : public GlobalTableFunctionState {
 public:
-    EdgesVertexGlobalTableFunctionState(ClientContext& context, EdgesVertexBindData& bind_data,
-                                        std::shared_ptr<graphar::EdgeInfo> edge_info, const std::string& prefix,
-                                        idx_t iter, idx_t end_iter)
-        : state(context, bind_data, edge_info, prefix, iter, end_iter) {};
+    EdgesVertexGlobalTableFunctionState(ClientContext& context, const EdgesVertexBindData& bind_data, idx_t iter,
+                                        idx_t end_iter)
+        : state(context, bind_data, iter, end_iter) {};
 
     static unique_ptr<GlobalTableFunctionState> Init(ClientContext& context, TableFunctionInitInput& input);
 
+    idx_t MaxThreads() const override { return std::max<idx_t>(state.GetChunkNum(), 1); }
+
     EdgesVertexGlobalState& GetState() { return state; }
 
 private:
@@ -77,12 +167,30 @@ private:
     friend struct EdgesVertex;
 };
 
+// The offset chunk a thread is scanning and the vertices of it still to emit
+struct EdgesVertexLocalTableFunctionState : public LocalTableFunctionState {
+public:
+    static unique_ptr<LocalTableFunctionState> Init(ExecutionContext& context, TableFunctionInitInput& input,
+                                                    GlobalTableFunctionState* global_state);
+
+    // one offset chunk per source of the bind data
+    std::vector<std::shared_ptr<arrow::Int64Array>> offsets;
+    // degrees of the chunk per degree column, read from the degree indexes instead of the offsets
+    bool from_index = false;
+    std::vector<std::vector<int64_t>> degrees;
+    idx_t chunk_index = 0;
+    // vertex ids [iter, end_iter) of the chunk that are not emitted yet
+    idx_t iter = 0;
+    idx_t end_iter = 0;
+};
+
 struct EdgesVertex {
     static unique_ptr<FunctionData> Bind(ClientContext& context, TableFunctionBindInput& input,
                                          vector<LogicalType>& return_types, vector<string>& names);
-    static graphar::Result<vector<std::pair<graphar::IdType, graphar::IdType>>> GetAdjListOffsetOfVertices(
-        ClientContext& context, const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& prefix,
-        graphar::AdjListType adj_list_type, idx_t start, idx_t end);
+    static unique_ptr<BaseStatistics> GetStatistics(ClientContext& context, const FunctionData* bind_data,
+                                                    column_t column_index);
+    static unique_ptr<NodeStatistics> GetCardinality(ClientContext& context, const FunctionData* bind_data);
+    static OperatorPartitionData GetPartitionData(ClientContext& context, TableFunctionGetPartitionInput& input);
     static void Execute(ClientContext& context, TableFunctionInput& data, DataChunk& output);
     static void Register(ExtensionLoader& loader);
     static TableFunction GetFunction();
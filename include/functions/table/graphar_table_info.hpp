@@ -0,0 +1,41 @@
+#pragma once
+
+#include "utils/table_storage_stats.hpp"
+
+#include <duckdb/function/table_function.hpp>
+#include <duckdb/main/extension/extension_loader.hpp>
+
+#include <graphar/graph_info.h>
+
+namespace duckdb {
+
+class GraphArTableInfoBindData final : public TableFunctionData {
+public:
+    explicit GraphArTableInfoBindData(std::shared_ptr<graphar::GraphInfo> graph_info) : graph_info(graph_info) {};
+
+    const std::shared_ptr<graphar::GraphInfo>& GetGraphInfo() const { return graph_info; }
+
+private:
+    std::shared_ptr<graphar::GraphInfo> graph_info;
+};
+
+struct GraphArTableInfoGlobalTableFunctionState : public GlobalTableFunctionState {
+public:
+    static unique_ptr<GlobalTableFunctionState> Init(ClientContext& context, TableFunctionInitInput& input);
+
+    bool loaded = false;
+    vector<std::pair<std::string, std::string>> tables;
+    vector<TableStorageStats> stats;
+    idx_t offset = 0;
+};
+
+// graphar_table_info(graph_path) returns the on-disk bytes, files, chunks, rows and layout of every vertex and edge
+// table of a graph
+struct GraphArTableInfo {
+    static unique_ptr<FunctionData> Bind(ClientContext& context, TableFunctionBindInput& input,
+                                         vector<LogicalType>& return_types, vector<string>& names);
+    static void Execute(ClientContext& context, TableFunctionInput& data, DataChunk& output);
+    static void Register(ExtensionLoader& loader);
+    static TableFunction GetFunction();
+};
+}  // namespace duckdb
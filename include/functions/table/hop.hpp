@@ -1,7 +1,9 @@
 #pragma once
 
+#include "utils/degree_index.hpp"
 #include "utils/func.hpp"
 
+#include <duckdb/common/file_system.hpp>
 #include <duckdb/common/named_parameter_map.hpp>
 #include <duckdb/function/table_function.hpp>
 #include <duckdb/main/extension/extension_loader.hpp>
@@ -9,35 +11,139 @@
 #include <graphar/api/high_level_reader.h>
 #include <graphar/graph_info.h>
 
+#include <algorithm>
+#include <unordered_set>
+
 namespace duckdb {
 
 class TwoHopBindData final : public TableFunctionData {
 public:
-    TwoHopBindData(std::shared_ptr<graphar::EdgeInfo> edge_info, std::string prefix, graphar::IdType src_id)
-        : edge_info(edge_info), prefix(prefix), src_id(src_id) {};
+    TwoHopBindData(std::shared_ptr<graphar::EdgeInfo> edge_info, std::string prefix, graphar::IdType src_id,
+                   GraphArDirection direction, std::vector<std::string> edge_properties,
+                   std::shared_ptr<graphar::VertexInfo> vertex_info, std::string vertex_prefix,
+                   std::vector<std::string> vertex_properties)
+        : edge_info(edge_info),
+          prefix(prefix),
+          src_id(src_id),
+          direction(direction),
+          edge_properties(std::move(edge_properties)),
+          vertex_info(vertex_info),
+          vertex_prefix(vertex_prefix),
+          vertex_properties(std::move(vertex_properties)) {};
 
     const std::shared_ptr<graphar::EdgeInfo>& GetEdgeInfo() const { return edge_info; }
     const std::string& GetPrefix() const { return prefix; }
     graphar::IdType GetSrcId() const { return src_id; }
+    GraphArDirection GetDirection() const { return direction; }
+    const std::vector<std::string>& GetEdgeProperties() const { return edge_properties; }
+    const std::shared_ptr<graphar::VertexInfo>& GetVertexInfo() const { return vertex_info; }
+    const std::string& GetVertexPrefix() const { return vertex_prefix; }
+    const std::vector<std::string>& GetVertexProperties() const { return vertex_properties; }
 
 private:
     std::shared_ptr<graphar::EdgeInfo> edge_info;
     std::string prefix;
     graphar::IdType src_id;
+    GraphArDirection direction;
+    std::vector<std::string> edge_properties;
+    // neighbour vertex properties, only set when some are requested
+    std::shared_ptr<graphar::VertexInfo> vertex_info;
+    std::string vertex_prefix;
+    std::vector<std::string> vertex_properties;
 };
 
+// Degree indexes of the traversed adjacency lists, empty when some of them is missing or stale
+inline std::vector<unique_ptr<DegreeIndex>> OpenHopDegreeIndexes(ClientContext& context,
+                                                                 const TwoHopBindData& bind_data) {
+    std::vector<unique_ptr<DegreeIndex>> result;
+    const auto direction = bind_data.GetDirection();
+    for (auto adj_list_type : {graphar::AdjListType::ordered_by_source, graphar::AdjListType::ordered_by_dest}) {
+        if ((adj_list_type == graphar::AdjListType::ordered_by_source) == (direction == GraphArDirection::In)) {
+            continue;
+        }
+        auto index = DegreeIndex::Open(context, bind_data.GetEdgeInfo(), bind_data.GetPrefix(), adj_list_type);
+        if (!index) {
+            return {};
+        }
+        result.push_back(std::move(index));
+    }
+    return result;
+}
+
+// Degrees read from a degree index at once when the hop ids are filtered
+static constexpr idx_t HOP_DEGREE_BLOCK_SIZE = 4096;
+
+// The distinct vids with edges to traverse, in ascending order. The degrees of nearby vids are read together, one
+// block of HOP_DEGREE_BLOCK_SIZE degrees per read.
+inline std::vector<std::int64_t> FilterVerticesWithEdges(const std::vector<unique_ptr<DegreeIndex>>& degree_indexes,
+                                                         std::vector<std::int64_t> vids) {
+    std::sort(vids.begin(), vids.end());
+    vids.erase(std::unique(vids.begin(), vids.end()), vids.end());
+    std::vector<bool> has_edges(vids.size(), false);
+    std::vector<int64_t> degrees;
+    for (const auto& index : degree_indexes) {
+        const auto vertex_count = static_cast<std::int64_t>(index->GetVertexCount());
+        idx_t i = 0;
+        while (i < vids.size() && vids[i] < 0) {
+            ++i;
+        }
+        while (i < vids.size() && vids[i] < vertex_count) {
+            const idx_t begin = vids[i];
+            const idx_t count = std::min<idx_t>(HOP_DEGREE_BLOCK_SIZE, vertex_count - begin);
+            degrees.resize(count);
+            index->Read(begin, count, degrees.data());
+            for (; i < vids.size() && static_cast<idx_t>(vids[i]) < begin + count; ++i) {
+                has_edges[i] = has_edges[i] || degrees[vids[i] - begin] > 0;
+            }
+        }
+    }
+    idx_t kept = 0;
+    for (idx_t i = 0; i < vids.size(); ++i) {
+        if (has_edges[i]) {
+            vids[kept++] = vids[i];
+        }
+    }
+    vids.resize(kept);
+    return vids;
+}
+
+// Neighbour vertex properties of a hop result, or nullptr when none are requested
+inline unique_ptr<VertexPropertyLookup> MakeNeighbourLookup(const TwoHopBindData& bind_data) {
+    if (bind_data.GetVertexProperties().empty()) {
+        return nullptr;
+    }
+    return make_uniq<VertexPropertyLookup>(bind_data.GetVertexInfo(), bind_data.GetVertexPrefix(),
+                                           bind_data.GetVertexProperties());
+}
+
 struct TwoHopGlobalState {
 public:
     TwoHopGlobalState(ClientContext& context, const TwoHopBindData& bind_data)
-        : src_reader(MyAdjReaderOrdSrc(bind_data.GetEdgeInfo(), bind_data.GetPrefix())) {
-        src_reader.find_src(bind_data.GetSrcId());
+        : src_reader(FileSystem::GetFileSystem(context), bind_data.GetEdgeInfo(), bind_data.GetPrefix(),
+                     bind_data.GetDirection(), bind_data.GetEdgeProperties()),
+          neighbour_lookup(MakeNeighbourLookup(bind_data)),
+          degree_indexes(OpenHopDegreeIndexes(context, bind_data)) {
+        src_reader.find(bind_data.GetSrcId());
         hop_ids.reserve(src_reader.size());
     };
 
     const std::vector<std::int64_t>& GetHopIds() const { return hop_ids; }
     bool IsOneHop() const { return one_hop; }
     void SetOneHop(bool one_hop_) { one_hop = one_hop_; }
-    MyAdjReaderOrdSrc& GetSrcReader() { return src_reader; }
+    MyDirectedAdjReader& GetSrcReader() { return src_reader; }
+    VertexPropertyLookup* GetNeighbourLookup() { return neighbour_lookup.get(); }
+    // Drops the hop ids without edges to traverse; without degree indexes every vertex is looked up
+    void DropHopIdsWithoutEdges() {
+        if (degree_indexes.empty()) {
+            return;
+        }
+        const auto with_edges = FilterVerticesWithEdges(degree_indexes, hop_ids);
+        hop_ids.erase(std::remove_if(hop_ids.begin(), hop_ids.end(),
+                                     [&](std::int64_t vid) {
+                                         return !std::binary_search(with_edges.begin(), with_edges.end(), vid);
+                                     }),
+                      hop_ids.end());
+    }
     size_t GetHopI() const { return hop_i; }
     size_t IncrementHopI() { return hop_i++; }
     void AddHopId(std::int64_t id) { hop_ids.push_back(id); }
@@ -45,7 +151,9 @@ public:
 private:
     std::vector<std::int64_t> hop_ids;
     bool one_hop = true;
-    MyAdjReaderOrdSrc src_reader;
+    MyDirectedAdjReader src_reader;
+    unique_ptr<VertexPropertyLookup> neighbour_lookup;
+    std::vector<unique_ptr<DegreeIndex>> degree_indexes;
     size_t hop_i = 0;
 };
 
@@ -73,17 +181,31 @@ struct TwoHop {
 struct OneMoreHopGlobalState {
 public:
     OneMoreHopGlobalState(ClientContext& context, const TwoHopBindData& bind_data)
-        : src_reader(MyAdjReaderOrdSrc(bind_data.GetEdgeInfo(), bind_data.GetPrefix())) {
-        src_reader.find_src(bind_data.GetSrcId());
+        : src_reader(FileSystem::GetFileSystem(context), bind_data.GetEdgeInfo(), bind_data.GetPrefix(),
+                     bind_data.GetDirection(), bind_data.GetEdgeProperties()),
+          neighbour_lookup(MakeNeighbourLookup(bind_data)),
+          degree_indexes(OpenHopDegreeIndexes(context, bind_data)) {
+        src_reader.find(bind_data.GetSrcId());
         hop_ids.reserve(src_reader.size());
-        hop_i = hop_ids.begin();
     };
 
 public:
     std::unordered_set<std::int64_t> hop_ids;
     bool one_hop = true;
-    MyAdjReaderOrdSrc src_reader;
+    MyDirectedAdjReader src_reader;
+    unique_ptr<VertexPropertyLookup> neighbour_lookup;
+    std::vector<unique_ptr<DegreeIndex>> degree_indexes;
     std::unordered_set<std::int64_t>::const_iterator hop_i;
+
+    // Drops the hop ids without edges to traverse; without degree indexes every vertex is looked up
+    void DropHopIdsWithoutEdges() {
+        if (degree_indexes.empty()) {
+            return;
+        }
+        const auto with_edges = FilterVerticesWithEdges(
+            degree_indexes, std::vector<std::int64_t>(hop_ids.begin(), hop_ids.end()));
+        hop_ids = std::unordered_set<std::int64_t>(with_edges.begin(), with_edges.end());
+    }
 };
 
 struct OneMoreHopGlobalTableFunctionState : public GlobalTableFunctionState {
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "utils/benchmark.hpp"
+#include "utils/chunk_prefetcher.hpp"
 #include "utils/func.hpp"
 #include "utils/global_log_manager.hpp"
 
 #include <arrow/c/bridge.h>
 
+#include <duckdb/common/arrow/arrow_wrapper.hpp>
 #include <duckdb/common/named_parameter_map.hpp>
+#include <duckdb/common/optional_idx.hpp>
 #include <duckdb/function/table/arrow.hpp>
 #include <duckdb/function/table_function.hpp>
 #include <duckdb/main/extension/extension_loader.hpp>
@@ -18,6 +21,7 @@
 #include <graphar/fwd.h>
 #include <graphar/reader_util.h>
 
+#include <atomic>
 #include <filesystem>
 #include <iostream>
 #include <sstream>
@@ -37,11 +41,12 @@ static graphar::Result<std::shared_ptr<arrow::Table>> GetChunk(Reader& reader) {
     return std::visit([](auto& r) { return r.GetChunk(); }, reader);
 }
 
-static graphar::Status seek_chunk_index(Reader& reader, graphar::IdType vertex_chunk_index) {
+static graphar::Status seek_chunk_index(Reader& reader, graphar::IdType vertex_chunk_index,
+                                        graphar::IdType chunk_index = 0) {
     return std::visit(
         [&](auto& r) {
-            if constexpr (requires { r.seek_chunk_index(vertex_chunk_index); }) {
-                return r.seek_chunk_index(vertex_chunk_index);
+            if constexpr (requires { r.seek_chunk_index(vertex_chunk_index, chunk_index); }) {
+                return r.seek_chunk_index(vertex_chunk_index, chunk_index);
             } else {
                 return graphar::Status::TypeError("seek_chunk_index is not implemented for this type of reader");
             }
@@ -95,6 +100,40 @@ public:
     vector<std::string>& GetFlattenPropTypes() { return flatten_prop_types; }
     const std::shared_ptr<graphar::GraphInfo>& GetGraphInfo() const { return graph_info; }
 
+    // Column the scan output is sorted by: the vertex id, or the side of the edges the read adjacency list is
+    // ordered by
+    std::string GetOrderColumn() const {
+        if (function_name == "read_vertices") {
+            return GID_COLUMN_INTERNAL;
+        }
+        if (!filter_column.empty()) {
+            return filter_column;
+        }
+        if (delta_chunk_num > 0) {
+            // the delta chunks of inserted edges follow the sorted chunks unsorted
+            return "";
+        }
+        return adj_list_type == graphar::AdjListType::ordered_by_dest ? DST_GID_COLUMN : SRC_GID_COLUMN;
+    }
+    // Switches an unfiltered edge scan to the adjacency list ordered by the column; false when it is not possible
+    bool SetOrderColumn(const std::string& column) {
+        if (function_name != "read_edges" || !filter_column.empty() || delta_chunk_num > 0 ||
+            (column != SRC_GID_COLUMN && column != DST_GID_COLUMN)) {
+            return false;
+        }
+        const auto type = column == SRC_GID_COLUMN ? graphar::AdjListType::ordered_by_source
+                                                   : graphar::AdjListType::ordered_by_dest;
+        if (!graph_info->GetEdgeInfo(params[0], params[1], params[2])->HasAdjacentListType(type)) {
+            return false;
+        }
+        adj_list_type = type;
+        return true;
+    }
+    // Caps the rows the scan has to produce, when a LIMIT directly consumes it
+    void SetRowLimit(idx_t limit) {
+        row_limit = row_limit.IsValid() ? std::min(row_limit.GetIndex(), limit) : limit;
+    }
+
 private:
     vector<vector<std::string>> prop_names;
     vector<std::string> flatten_prop_names;
@@ -108,6 +147,14 @@ private:
 
     std::pair<graphar::IdType, graphar::IdType> vid_range = {-1, -1};
     std::string filter_column;
+    // Adjacency list read by unfiltered edge scans; the edges come out in its order
+    graphar::AdjListType adj_list_type = graphar::AdjListType::ordered_by_source;
+    // Rows a LIMIT above the scan takes at most; unfiltered scans stop claiming partitions once they have read them
+    optional_idx row_limit;
+    // Delta chunks of edges inserted since the last checkpoint, scanned after the sorted chunks
+    idx_t delta_chunk_num = 0;
+    // Edges of the type, known without a scan only when a degree index was built
+    optional_idx edge_count;
 
     template <typename ReadFinal>
     friend class ReadBase;
@@ -115,6 +162,39 @@ private:
     friend class ReadEdges;
 };
 
+// Where an output column is read from: the reader of its property group and its position in the chunk tables of
+// that reader
+struct ReadBaseOutputColumn {
+    idx_t reader;
+    idx_t column;
+};
+
+// Arrow schema of the chunk tables of one reader, converted for DuckDB once per scan and again only if the tables of
+// the reader change their schema
+struct ReaderArrowSchema {
+    std::shared_ptr<arrow::Schema> source;
+    ArrowSchemaWrapper schema;
+    ArrowTableSchema table_schema;
+};
+
+// Where a filtered scan starts: the vertex chunk, the chunk within it (always 0 for vertices) and the row within the
+// chunk file
+struct ChunkRowPosition {
+    graphar::IdType vertex_chunk = -1;
+    graphar::IdType chunk = 0;
+    idx_t row = 0;
+};
+
+// Vertex chunk of the partitions that read a delta chunk of inserted edges, whose index is the edge chunk
+static constexpr graphar::IdType DELTA_PARTITION = -1;
+
+// Columns of the current chunk table of one reader, exported to the Arrow C interface once per chunk; every vector
+// converts its slice of them by offset
+struct ReaderChunkArrays {
+    std::shared_ptr<arrow::Table> table;
+    vector<shared_ptr<ArrowArrayWrapper>> columns;
+};
+
 class ReadBaseGlobalTableFunctionState : public GlobalTableFunctionState {
 private:
     graphar::PropertyGroupVector pgs;
@@ -128,10 +208,26 @@ private:
     vector<idx_t> indices;
     vector<idx_t> sizes;
     std::pair<int64_t, int64_t> filter_range = {-1, -1};
+    ChunkRowPosition filter_position;
     std::string function_name;
     int64_t total_rows = 0;
     vector<column_t> column_ids;
-    idx_t columns_to_remove = 0;
+    vector<ReadBaseOutputColumn> output_columns;
+    vector<unique_ptr<ReaderArrowSchema>> schemas;
+    vector<ReaderChunkArrays> arrays;
+
+    // Unfiltered scans are split into partitions (vertex chunk, edge chunk) that the threads claim in order;
+    // filtered scans keep the single sequential reader set above
+    bool partitioned = false;
+    vector<std::pair<graphar::IdType, graphar::IdType>> partitions;
+    std::atomic<idx_t> next_partition{0};
+    optional_ptr<const ReadBindData> bind_data;
+    // rows of the partitions claimed so far, checked against the row limit
+    std::atomic<idx_t> claimed_rows{0};
+    idx_t max_threads = 1;
+
+public:
+    idx_t MaxThreads() const override { return max_threads; }
 
     template <typename ReadFinal>
     friend class ReadBase;
@@ -139,6 +235,24 @@ private:
     friend class ReadEdges;
 };
 
+// Readers of one thread of a partitioned scan and the partition it is emitting
+class ReadBaseLocalTableFunctionState : public LocalTableFunctionState {
+private:
+    vector<std::shared_ptr<Reader>> readers;
+    // chunk of every reader for the partition, all with the same rows
+    vector<std::shared_ptr<arrow::Table>> tables;
+    vector<idx_t> offsets;
+    idx_t rows = 0;
+    idx_t partition_index = 0;
+    vector<unique_ptr<ReaderArrowSchema>> schemas;
+    vector<ReaderChunkArrays> arrays;
+    // reads the next partitions with the readers above while this one is emitted; stopped before they are destroyed
+    unique_ptr<ChunkPrefetcher> prefetcher;
+
+    template <typename ReadFinal>
+    friend class ReadBase;
+};
+
 template <typename ReadFinal>
 class ReadBase {
 public:
@@ -211,6 +325,7 @@ public:
         DUCKDB_GRAPHAR_LOG_TRACE("ReadBase::NextChunk");
         auto& reader = gstate.readers[reader_i];
         int& first_chunk_flag = gstate.first_chunk_flags[reader_i];
+        const bool first_chunk = first_chunk_flag;
         if (first_chunk_flag) {
             first_chunk_flag = false;
         } else {
@@ -221,11 +336,17 @@ public:
                                                                      gstate.prop_types[reader_i]);
             }
         }
-        auto result = GetChunk(*reader);
-        if (result.has_error()) {
-            throw std::runtime_error("Failed to get chunk" + result.status().message());
+        std::shared_ptr<arrow::Table> table;
+        if (first_chunk && gstate.filter_position.vertex_chunk != -1) {
+            table = ReadFilteredChunk(reader_i, gstate);
+        }
+        if (!table) {
+            auto result = GetChunk(*reader);
+            if (result.has_error()) {
+                throw std::runtime_error("Failed to get chunk" + result.status().message());
+            }
+            table = result.value();
         }
-        auto table = result.value();
         if (gstate.filter_range.first != -1) {
             if (gstate.total_rows >= gstate.filter_range.second) {
                 DUCKDB_GRAPHAR_LOG_DEBUG("All rows read");
@@ -243,6 +364,29 @@ public:
         return table;
     }
 
+    // Reads the filtered rows of the chunk the filtered scan starts in, decoding only the Parquet row groups that
+    // hold them instead of the whole chunk; nullptr when the chunk file of the reader is not Parquet
+    static std::shared_ptr<arrow::Table> ReadFilteredChunk(idx_t reader_i, ReadBaseGlobalTableFunctionState& gstate) {
+        const auto& bind_data = *gstate.bind_data;
+        const auto count = gstate.filter_range.second - gstate.filter_range.first;
+        if (count <= 0) {
+            return GraphArFunctions::EmptyTableFromNamesAndTypes(gstate.prop_names[reader_i],
+                                                                 gstate.prop_types[reader_i]);
+        }
+        const auto path = ReadFinal::GetChunkFilePath(bind_data, reader_i, gstate.filter_position);
+        if (path.empty()) {
+            return nullptr;
+        }
+        auto table = ReadParquetRows(bind_data.graph_info->GetPrefix(), path, gstate.filter_position.row, count);
+        // the chunk tables of the GraphAr readers are laid out like the files; anything else is left to the reader
+        const idx_t removed_columns = reader_i ? bind_data.columns_to_remove : 0;
+        if (static_cast<idx_t>(table->num_columns()) != gstate.prop_names[reader_i].size() + removed_columns) {
+            DUCKDB_GRAPHAR_LOG_DEBUG("Unexpected columns in " + path + ", reading the whole chunk");
+            return nullptr;
+        }
+        return table;
+    }
+
     static std::shared_ptr<Reader> GetReader(ReadBaseGlobalTableFunctionState& gstate, ReadBindData& bind_data,
                                              idx_t ind, const std::string& filter_column) {
         return ReadFinal::GetReader(gstate, bind_data, ind, filter_column);
@@ -268,54 +412,77 @@ public:
             t.print("cast");
         }
 
-        ReadBaseGlobalTableFunctionState gstate;
+        auto state = make_uniq<ReadBaseGlobalTableFunctionState>();
+        auto& gstate = *state;
 
         DUCKDB_GRAPHAR_LOG_DEBUG("Init global state");
 
         gstate.function_name = bind_data.function_name;
-        gstate.columns_to_remove = bind_data.columns_to_remove;
         gstate.pgs = bind_data.pgs;
         gstate.column_ids = input.column_ids;
         if (gstate.column_ids.empty() ||
             (gstate.column_ids.size() == 1 && gstate.column_ids[0] == COLUMN_IDENTIFIER_ROW_ID)) {
             gstate.column_ids = {0};
         }
+        gstate.prop_names = bind_data.prop_names;
+        gstate.prop_types = bind_data.prop_types;
+        gstate.output_columns = GetOutputColumns(bind_data, gstate.column_ids);
+        for (const auto& names : gstate.prop_names) {
+            gstate.total_props_num += names.size();
+        }
+        DUCKDB_GRAPHAR_LOG_DEBUG("total props num: " + std::to_string(gstate.total_props_num));
+
+        const auto& filter_column = bind_data.filter_column;
+        gstate.bind_data = &input.bind_data->Cast<ReadBindData>();
+        if (filter_column.empty()) {
+            // Readers are created per thread, nothing is read until the threads claim their partitions
+            gstate.partitioned = true;
+            gstate.partitions = ReadFinal::GetPartitions(bind_data);
+            gstate.max_threads = std::max<idx_t>(gstate.partitions.size(), 1);
+            if (bind_data.row_limit.IsValid()) {
+                // no more threads than partitions the limit can span
+                const auto partition_rows = std::max<idx_t>(ReadFinal::GetPartitionRows(bind_data), 1);
+                const auto limit_partitions = (bind_data.row_limit.GetIndex() + partition_rows - 1) / partition_rows;
+                gstate.max_threads = std::min(gstate.max_threads, std::max<idx_t>(limit_partitions, 1));
+            }
+            DUCKDB_GRAPHAR_LOG_DEBUG("partitions num: " + std::to_string(gstate.partitions.size()));
+            if (time_logging) {
+                t.print();
+            }
+            return std::move(state);
+        }
+
         gstate.readers.resize(bind_data.prop_types.size());
         gstate.first_chunk_flags.resize(gstate.readers.size(), true);
         gstate.tables.resize(gstate.readers.size());
         gstate.sizes.resize(gstate.readers.size());
         gstate.indices.resize(gstate.readers.size(), 0);
+        gstate.schemas.resize(gstate.readers.size());
+        gstate.arrays.resize(gstate.readers.size());
 
         DUCKDB_GRAPHAR_LOG_DEBUG("readers num: " + std::to_string(gstate.readers.size()));
 
-        const auto& filter_column = bind_data.filter_column;
-
         idx_t reader_i = 0;
         std::generate(gstate.readers.begin(), gstate.readers.end(),
                       [&]() { return GetReader(gstate, bind_data, reader_i++, filter_column); });
         if (time_logging) {
             t.print("readers creation");
         }
-        if (filter_column != "") {
-            auto vid_range = bind_data.vid_range;
-            const auto vertex_num = (filter_column == DST_GID_COLUMN)
-                                        ? GraphArFunctions::GetVertexNum(bind_data.graph_info, bind_data.params[2])
-                                        : GraphArFunctions::GetVertexNum(bind_data.graph_info, bind_data.params[0]);
-            graphar::IdType zero = 0;
-            vid_range.first = std::max(zero, vid_range.first);
-            vid_range.second = std::min(vertex_num - 1, vid_range.second);
-            if (vid_range.first > vid_range.second) {
-                throw IOException("Invalid filter range");
-            }
-            SetFilter(gstate, bind_data, vid_range, filter_column);
+        auto vid_range = bind_data.vid_range;
+        const auto vertex_num = (filter_column == DST_GID_COLUMN)
+                                    ? GraphArFunctions::GetVertexNum(bind_data.graph_info, bind_data.params[2])
+                                    : GraphArFunctions::GetVertexNum(bind_data.graph_info, bind_data.params[0]);
+        graphar::IdType zero = 0;
+        vid_range.first = std::max(zero, vid_range.first);
+        vid_range.second = std::min(vertex_num - 1, vid_range.second);
+        if (vid_range.first > vid_range.second) {
+            throw IOException("Invalid filter range");
         }
+        SetFilter(gstate, bind_data, vid_range, filter_column);
         if (time_logging) {
             t.print("filter setting");
         }
 
-        gstate.prop_names = bind_data.prop_names;
-        gstate.prop_types = bind_data.prop_types;
-
         for (idx_t i = 0; i < gstate.readers.size(); i++) {
             DUCKDB_GRAPHAR_LOG_TRACE("Get chunk for reader " + std::to_string(i));
             auto result = NextChunk(i, gstate);
@@ -326,17 +493,10 @@ public:
                 throw std::runtime_error("Error while getting chunk: " + result.status().message());
             }
             gstate.tables[i] = result.value();
-            if (i) {
-                for (idx_t j = 0; j < bind_data.columns_to_remove; j++) {
-                    gstate.tables[i] = gstate.tables[i]->RemoveColumn(0).ValueOrDie();
-                }
-            }
             DUCKDB_GRAPHAR_LOG_DEBUG("Table Schema: " + gstate.tables[i]->schema()->ToString());
 
             gstate.sizes[i] = gstate.tables[i]->num_rows();
-            gstate.total_props_num += gstate.tables[i]->num_columns();
         }
-        DUCKDB_GRAPHAR_LOG_DEBUG("total props num: " + std::to_string(gstate.total_props_num));
 
         if (time_logging) {
             t.print("additional info");
@@ -347,95 +507,240 @@ public:
             t.print();
         }
 
-        return make_uniq<ReadBaseGlobalTableFunctionState>(std::move(gstate));
+        return std::move(state);
     }
 
-    static arrow::Result<std::shared_ptr<arrow::Table>> ConcatenateTables(
-        const vector<std::shared_ptr<arrow::Table>>& tables) {
-        DUCKDB_GRAPHAR_LOG_TRACE("ConcatenateTables started");
-        if (tables.empty()) {
-            return arrow::Status::Invalid("Cannot concatenate empty vector of tables");
+    static unique_ptr<LocalTableFunctionState> InitLocal(ExecutionContext& context, TableFunctionInitInput& input,
+                                                         GlobalTableFunctionState* global_state) {
+        DUCKDB_GRAPHAR_LOG_TRACE("ReadBase::InitLocal");
+        auto& gstate = global_state->Cast<ReadBaseGlobalTableFunctionState>();
+        auto result = make_uniq<ReadBaseLocalTableFunctionState>();
+        if (!gstate.partitioned) {
+            return std::move(result);
+        }
+        auto bind_data = input.bind_data->Cast<ReadBindData>();
+        result->readers.resize(bind_data.prop_types.size());
+        result->offsets.resize(result->readers.size());
+        result->schemas.resize(result->readers.size());
+        result->arrays.resize(result->readers.size());
+        for (idx_t i = 0; i < result->readers.size(); ++i) {
+            result->readers[i] = GetReader(gstate, bind_data, i, "");
         }
+        const auto prefetch_depth = GraphArSettings::get_prefetch_depth(context.client);
+        if (prefetch_depth > 0 && gstate.partitions.size() > 1) {
+            auto& readers = result->readers;
+            auto read = [&gstate, &readers](PrefetchedPartition& partition) {
+                return ReadPartition(gstate, readers, partition);
+            };
+            result->prefetcher =
+                make_uniq<ChunkPrefetcher>(context.client, std::move(read), prefetch_depth,
+                                           GraphArSettings::get_prefetch_memory_limit(context.client));
+        }
+        return std::move(result);
+    }
 
-        const idx_t num_rows = tables[0]->num_rows();
-        idx_t total_columns = 0;
-        for (idx_t i = 1; i < tables.size(); ++i) {
-            if (tables[i]->num_rows() != num_rows) {
-                return arrow::Status::Invalid("All tables must have the same number of rows");
+    // Claims the next partition and reads the chunk of every property group of it
+    static bool ReadPartition(ReadBaseGlobalTableFunctionState& gstate, vector<std::shared_ptr<Reader>>& readers,
+                              PrefetchedPartition& result) {
+        const auto& row_limit = gstate.bind_data->row_limit;
+        if (row_limit.IsValid() && gstate.claimed_rows >= row_limit.GetIndex()) {
+            DUCKDB_GRAPHAR_LOG_DEBUG("Row limit reached");
+            return false;
+        }
+        const idx_t partition_index = gstate.next_partition++;
+        if (partition_index >= gstate.partitions.size()) {
+            return false;
+        }
+        DUCKDB_GRAPHAR_LOG_DEBUG("Read partition " + std::to_string(partition_index));
+        const auto& partition = gstate.partitions[partition_index];
+        result.partition_index = partition_index;
+        result.tables.resize(readers.size());
+        if (partition.first == DELTA_PARTITION) {
+            ReadDeltaPartition(gstate, partition.second, result);
+            gstate.claimed_rows += result.tables[0]->num_rows();
+            return true;
+        }
+        for (idx_t i = 0; i < readers.size(); ++i) {
+            auto& reader = *readers[i];
+            auto status = ReadFinal::SeekPartition(reader, *gstate.bind_data, partition);
+            if (!status.ok()) {
+                throw IOException("Failed to seek " + gstate.function_name + " reader: " + status.message());
+            }
+            auto maybe_table = GetChunk(reader);
+            if (maybe_table.has_error()) {
+                throw IOException("Failed to get chunk: " + maybe_table.status().message());
+            }
+            result.tables[i] = maybe_table.value();
+            if (result.tables[i]->num_rows() != result.tables[0]->num_rows()) {
+                throw IOException("Chunks of the property groups of " + gstate.function_name +
+                                  " have different numbers of rows");
             }
-            total_columns += tables[i]->num_columns();
         }
+        if (!result.tables.empty()) {
+            gstate.claimed_rows += result.tables[0]->num_rows();
+        }
+        return true;
+    }
 
-        vector<std::shared_ptr<arrow::Field>> all_fields;
-        all_fields.reserve(total_columns);
-        vector<std::shared_ptr<arrow::ChunkedArray>> all_columns;
-        all_columns.reserve(total_columns);
-
-        for (const auto& table : tables) {
-            for (idx_t i = 0; i < table->num_columns(); ++i) {
-                all_fields.emplace_back(table->field(i));
-                all_columns.emplace_back(table->column(i));
+    // Splits a delta chunk into the chunk tables the readers of its columns would have returned
+    static void ReadDeltaPartition(ReadBaseGlobalTableFunctionState& gstate, graphar::IdType chunk,
+                                   PrefetchedPartition& result) {
+        if constexpr (requires { ReadFinal::ReadDeltaChunk(*gstate.bind_data, chunk); }) {
+            auto table = ReadFinal::ReadDeltaChunk(*gstate.bind_data, chunk);
+            for (idx_t i = 0; i < result.tables.size(); ++i) {
+                std::vector<std::shared_ptr<arrow::Field>> fields;
+                std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+                for (const auto& name : gstate.prop_names[i]) {
+                    auto column = table->GetColumnByName(name);
+                    if (!column) {
+                        throw IOException("Column " + name + " is missing from delta chunk " + std::to_string(chunk));
+                    }
+                    fields.push_back(arrow::field(name, column->type()));
+                    columns.push_back(std::move(column));
+                }
+                result.tables[i] = arrow::Table::Make(arrow::schema(fields), columns, table->num_rows());
             }
+        } else {
+            throw InternalException(gstate.function_name + " has no delta chunks");
         }
-
-        const auto combined_schema = std::make_shared<arrow::Schema>(std::move(all_fields));
-        return arrow::Table::Make(std::move(combined_schema), std::move(all_columns), num_rows);
     }
 
-    static void ConvertArrowTableToDataChunk(const arrow::Table& table, DataChunk& output,
-                                             const vector<column_t>& column_ids, ClientContext& context) {
-        auto schema = table.schema();
+    // Moves on to the next partition of the thread, read ahead by its prefetcher when there is one
+    static bool NextPartition(ReadBaseGlobalTableFunctionState& gstate, ReadBaseLocalTableFunctionState& lstate) {
+        PrefetchedPartition partition;
+        const bool has_partition = lstate.prefetcher ? lstate.prefetcher->Next(partition)
+                                                     : ReadPartition(gstate, lstate.readers, partition);
+        if (!has_partition) {
+            return false;
+        }
+        lstate.tables = std::move(partition.tables);
+        lstate.rows = lstate.tables.empty() ? 0 : lstate.tables[0]->num_rows();
+        std::fill(lstate.offsets.begin(), lstate.offsets.end(), 0);
+        lstate.partition_index = partition.partition_index;
+        return true;
+    }
 
-        ArrowSchema c_schema;
-        auto export_schema_status = arrow::ExportSchema(*schema, &c_schema);
-        if (!export_schema_status.ok()) {
-            throw std::runtime_error("Failed to export schema: " + export_schema_status.message());
+    static void ExecutePartitioned(ClientContext& context, ReadBaseGlobalTableFunctionState& gstate,
+                                   ReadBaseLocalTableFunctionState& lstate, DataChunk& output) {
+        while (lstate.offsets.empty() || lstate.offsets[0] >= lstate.rows) {
+            if (!NextPartition(gstate, lstate)) {
+                output.SetCardinality(0);
+                return;
+            }
+        }
+        const idx_t num_rows = std::min<idx_t>(STANDARD_VECTOR_SIZE, lstate.rows - lstate.offsets[0]);
+        ConvertColumns(context, lstate.tables, lstate.offsets, num_rows, gstate.output_columns, lstate.schemas,
+                       lstate.arrays, output);
+        for (auto& offset : lstate.offsets) {
+            offset += num_rows;
         }
+        output.SetCardinality(num_rows);
+    }
 
-        ArrowTableSchema arrow_table_schema;
-        ArrowTableFunction::PopulateArrowTableSchema(context.db->config, arrow_table_schema, c_schema);
+    static OperatorPartitionData GetPartitionData(ClientContext& context, TableFunctionGetPartitionInput& input) {
+        if (input.partition_info.RequiresPartitionColumns()) {
+            throw InternalException("ReadBase::GetPartitionData: partition columns not supported");
+        }
+        // Partitions are claimed in order, so their index keeps the output in the order of the files
+        return OperatorPartitionData(input.local_state->Cast<ReadBaseLocalTableFunctionState>().partition_index);
+    }
 
-        const auto num_rows = table.num_rows();
-        output.SetCapacity(num_rows);
-        output.SetCardinality(num_rows);
-        for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
-            auto& arrow_type = *arrow_table_schema.GetColumns().at(column_ids[col_idx]);
-            if (arrow_type.GetDuckType().id() == LogicalTypeId::VARCHAR) {
-                for (idx_t row_i = 0; row_i < num_rows; row_i++) {
-                    auto maybe_value = table.column(column_ids[col_idx])->GetScalar(row_i);
-                    if (!maybe_value.ok()) {
-                        throw std::runtime_error("Failed to get value from table: " + maybe_value.status().ToString());
-                    }
-                    auto value = maybe_value.ValueUnsafe();
-                    auto duckdb_value = GraphArFunctions::ArrowScalar2DuckValue(value);
-                    output.SetValue(col_idx, row_i, duckdb_value);
-                }
-                continue;
+    // Resolves once per scan which reader and which column of its chunk tables every projected column comes from
+    static vector<ReadBaseOutputColumn> GetOutputColumns(const ReadBindData& bind_data,
+                                                         const vector<column_t>& column_ids) {
+        vector<ReadBaseOutputColumn> result;
+        result.reserve(column_ids.size());
+        for (auto column_id : column_ids) {
+            if (column_id >= bind_data.flatten_prop_names.size()) {
+                throw InternalException(bind_data.function_name + ": unknown column " + std::to_string(column_id));
             }
+            idx_t reader = 0;
+            idx_t column = column_id;
+            while (column >= bind_data.prop_names[reader].size()) {
+                column -= bind_data.prop_names[reader].size();
+                ++reader;
+            }
+            // the chunk tables of the property readers start with the removed id columns
+            result.push_back({reader, reader ? column + bind_data.columns_to_remove : column});
+        }
+        return result;
+    }
 
-            auto arrow_column = table.column(column_ids[col_idx]);
-
-            auto flatten_result = arrow::Concatenate(arrow_column->chunks());
-            if (!flatten_result.ok()) {
-                throw std::runtime_error("Failed to flatten Arrow column");
+    static const ArrowTableSchema& GetArrowSchema(ClientContext& context,
+                                                  vector<unique_ptr<ReaderArrowSchema>>& schemas, idx_t reader,
+                                                  const arrow::Table& table) {
+        if (!schemas[reader] ||
+            (schemas[reader]->source != table.schema() && !schemas[reader]->source->Equals(*table.schema()))) {
+            auto result = make_uniq<ReaderArrowSchema>();
+            result->source = table.schema();
+            auto export_schema_status = arrow::ExportSchema(*table.schema(), &result->schema.arrow_schema);
+            if (!export_schema_status.ok()) {
+                throw std::runtime_error("Failed to export schema: " + export_schema_status.message());
             }
-            auto arrow_array = flatten_result.ValueOrDie();
+            ArrowTableFunction::PopulateArrowTableSchema(context.db->config, result->table_schema,
+                                                         result->schema.arrow_schema);
+            schemas[reader] = std::move(result);
+        }
+        return schemas[reader]->table_schema;
+    }
 
-            ArrowArray c_array;
-            auto export_array_status = arrow::ExportArray(*arrow_array, &c_array);
-            if (!export_array_status.ok()) {
-                throw std::runtime_error("Failed to export Arrow array: " + export_array_status.message());
+    // Exports a column of the current chunk table of a reader, once per chunk. A column of a single Arrow chunk is
+    // exported as is and only referenced; a column of several chunks is concatenated once for the whole chunk table.
+    static shared_ptr<ArrowArrayWrapper> GetChunkArray(vector<ReaderChunkArrays>& arrays,
+                                                       const std::shared_ptr<arrow::Table>& table, idx_t reader,
+                                                       idx_t column) {
+        auto& chunk = arrays[reader];
+        if (chunk.table != table) {
+            chunk.table = table;
+            chunk.columns.clear();
+            chunk.columns.resize(table->num_columns());
+        }
+        auto& result = chunk.columns[column];
+        if (result) {
+            return result;
+        }
+        const auto& arrow_column = table->column(column);
+        std::shared_ptr<arrow::Array> array;
+        if (arrow_column->num_chunks() == 1) {
+            array = arrow_column->chunk(0);
+        } else {
+            auto maybe_array = arrow_column->num_chunks() == 0 ? arrow::MakeEmptyArray(arrow_column->type())
+                                                               : arrow::Concatenate(arrow_column->chunks());
+            if (!maybe_array.ok()) {
+                throw std::runtime_error("Failed to flatten Arrow column: " + maybe_array.status().message());
             }
+            array = maybe_array.ValueUnsafe();
+        }
+        result = make_shared_ptr<ArrowArrayWrapper>();
+        auto export_array_status = arrow::ExportArray(*array, &result->arrow_array);
+        if (!export_array_status.ok()) {
+            throw std::runtime_error("Failed to export Arrow array: " + export_array_status.message());
+        }
+        return result;
+    }
 
-            ArrowArrayScanState array_state(context);
-            array_state.owned_data = make_shared_ptr<ArrowArrayWrapper>();
-            array_state.owned_data->arrow_array = std::move(c_array);
+    // Converts num_rows rows of every output column, starting at the offset of its reader, into the output. The
+    // vectors reference the exported buffers where DuckDB can use the Arrow layout directly.
+    static void ConvertColumns(ClientContext& context, const vector<std::shared_ptr<arrow::Table>>& tables,
+                               const vector<idx_t>& offsets, idx_t num_rows,
+                               const vector<ReadBaseOutputColumn>& output_columns,
+                               vector<unique_ptr<ReaderArrowSchema>>& schemas, vector<ReaderChunkArrays>& arrays,
+                               DataChunk& output) {
+        output.SetCapacity(num_rows);
+        output.SetCardinality(num_rows);
+        for (idx_t col_idx = 0; col_idx < output_columns.size(); col_idx++) {
+            const auto& source = output_columns[col_idx];
+            const auto& table = tables[source.reader];
+            auto& arrow_type = *GetArrowSchema(context, schemas, source.reader, *table).GetColumns().at(source.column);
+            const auto offset = offsets[source.reader];
 
-            ArrowToDuckDBConversion::SetValidityMask(output.data[col_idx], array_state.owned_data->arrow_array, 0,
-                                                     output.size(), 0, -1);
+            ArrowArrayScanState array_state(context);
+            array_state.owned_data = GetChunkArray(arrays, table, source.reader, source.column);
+            auto& arrow_array = array_state.owned_data->arrow_array;
 
-            ArrowToDuckDBConversion::ColumnArrowToDuckDB(output.data[col_idx], array_state.owned_data->arrow_array, 0,
-                                                         array_state, output.size(), arrow_type);
+            ArrowToDuckDBConversion::SetValidityMask(output.data[col_idx], arrow_array, offset, num_rows, 0, -1);
+            ArrowToDuckDBConversion::ColumnArrowToDuckDB(output.data[col_idx], arrow_array, offset, array_state,
+                                                         num_rows, arrow_type);
         }
     }
 
@@ -447,6 +752,13 @@ public:
         DUCKDB_GRAPHAR_LOG_DEBUG("::Execute Cast state");
 
         ReadBaseGlobalTableFunctionState& gstate = input.global_state->Cast<ReadBaseGlobalTableFunctionState>();
+        if (gstate.partitioned) {
+            ExecutePartitioned(context, gstate, input.local_state->Cast<ReadBaseLocalTableFunctionState>(), output);
+            if (time_logging) {
+                t.print();
+            }
+            return;
+        }
 
         DUCKDB_GRAPHAR_LOG_DEBUG("Chunk " + std::to_string(gstate.chunk_count) + ": Begin iteration");
 
@@ -461,11 +773,6 @@ public:
                     throw std::runtime_error("Error while getting chunk: " + result.status().message());
                 }
                 gstate.tables[i] = result.value();
-                if (i) {
-                    for (idx_t j = 0; j < gstate.columns_to_remove; j++) {
-                        gstate.tables[i] = gstate.tables[i]->RemoveColumn(0).ValueOrDie();
-                    }
-                }
                 gstate.sizes[i] = gstate.tables[i]->num_rows();
                 gstate.indices[i] = 0;
             }
@@ -474,16 +781,8 @@ public:
         DUCKDB_GRAPHAR_LOG_DEBUG("num rows final: " + std::to_string(num_rows));
 
         if (num_rows > 0) {
-            vector<std::shared_ptr<arrow::Table>> tables_to_convert(gstate.tables.size());
-            for (idx_t i = 0; i < gstate.tables.size(); i++) {
-                tables_to_convert[i] = gstate.tables[i]->Slice(gstate.indices[i], num_rows);
-            }
-            auto maybe_table = ConcatenateTables(tables_to_convert);
-            if (!maybe_table.ok()) {
-                throw std::runtime_error("Failed to concatenate tables: " + maybe_table.status().ToString());
-            }
-            auto table = maybe_table.ValueOrDie();
-            ConvertArrowTableToDataChunk(*table, output, gstate.column_ids, context);
+            ConvertColumns(context, gstate.tables, gstate.indices, num_rows, gstate.output_columns, gstate.schemas,
+                           gstate.arrays, output);
             for (idx_t i = 0; i < gstate.tables.size(); i++) {
                 gstate.indices[i] += num_rows;
             }
@@ -18,15 +18,27 @@ class ReadEdges : public ReadBase<ReadEdges> {
 public:
     static void SetBindData(std::shared_ptr<graphar::GraphInfo> graph_info, const graphar::EdgeInfo& edge_info,
                             unique_ptr<ReadBindData>& bind_data);
+    // Reads how many delta chunks of inserted edges the scan has to read after the sorted chunks
+    static void SetDeltaChunkNum(ClientContext& context, ReadBindData& bind_data);
+    // Reads the edge count from a degree index once per bind, for GetCardinality
+    static void SetEdgeCount(ClientContext& context, ReadBindData& bind_data);
     static unique_ptr<FunctionData> Bind(ClientContext& context, TableFunctionBindInput& input,
                                          vector<LogicalType>& return_types, vector<string>& names);
 
     static std::shared_ptr<Reader> GetReader(ReadBaseGlobalTableFunctionState& gstate, ReadBindData& bind_data,
                                              idx_t ind, const std::string& filter_column);
+    static vector<std::pair<graphar::IdType, graphar::IdType>> GetPartitions(const ReadBindData& bind_data);
+    static idx_t GetPartitionRows(const ReadBindData& bind_data);
+    static std::string GetChunkFilePath(const ReadBindData& bind_data, idx_t ind, const ChunkRowPosition& position);
+    static graphar::Status SeekPartition(Reader& reader, const ReadBindData& bind_data,
+                                         const std::pair<graphar::IdType, graphar::IdType>& partition);
+    static std::shared_ptr<arrow::Table> ReadDeltaChunk(const ReadBindData& bind_data, graphar::IdType chunk);
 
     static unique_ptr<BaseStatistics> GetStatistics(ClientContext& context, const FunctionData* bind_data,
                                                     column_t column_index);
 
+    static unique_ptr<NodeStatistics> GetCardinality(ClientContext& context, const FunctionData* bind_data);
+
     static void PushdownComplexFilter(ClientContext& context, LogicalGet& get, FunctionData* bind_data,
                                       vector<unique_ptr<Expression>>& filters);
 
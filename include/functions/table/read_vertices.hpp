@@ -23,11 +23,18 @@ public:
 
     static std::shared_ptr<Reader> GetReader(ReadBaseGlobalTableFunctionState& gstate, ReadBindData& bind_data,
                                              idx_t ind, const std::string& filter_column);
+    static vector<std::pair<graphar::IdType, graphar::IdType>> GetPartitions(const ReadBindData& bind_data);
+    static idx_t GetPartitionRows(const ReadBindData& bind_data);
+    static std::string GetChunkFilePath(const ReadBindData& bind_data, idx_t ind, const ChunkRowPosition& position);
+    static graphar::Status SeekPartition(Reader& reader, const ReadBindData& bind_data,
+                                         const std::pair<graphar::IdType, graphar::IdType>& partition);
     static unique_ptr<BaseStatistics> GetStatistics(ClientContext& context, const FunctionData* bind_data,
                                                     column_t column_index);
 
     static void PushdownComplexFilter(ClientContext& context, LogicalGet& get, FunctionData* bind_data,
                                       vector<unique_ptr<Expression>>& filters);
+    static void PushdownKeyFilter(ClientContext& context, LogicalGet& get, ReadBindData& bind_data,
+                                  const vector<unique_ptr<Expression>>& filters);
 
     static TableFunction GetFunction();
 
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <duckdb/optimizer/optimizer_extension.hpp>
+#include <duckdb/planner/logical_operator.hpp>
+
+namespace duckdb {
+
+// Hands the row count of a constant LIMIT (plus its OFFSET) to the GraphAr scan right below it, so that the scan
+// stops reading chunks, and starting threads, once it has read that many rows.
+class GraphArScanLimit {
+public:
+    static OptimizerExtension GetExtension();
+    static void Optimize(OptimizerExtensionInput& input, unique_ptr<LogicalOperator>& plan);
+};
+
+}  // namespace duckdb
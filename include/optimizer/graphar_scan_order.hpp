@@ -0,0 +1,17 @@
+#pragma once
+
+#include <duckdb/optimizer/optimizer_extension.hpp>
+#include <duckdb/planner/logical_operator.hpp>
+
+namespace duckdb {
+
+// GraphAr scans come out sorted: vertices by their id, edges by the side their adjacency list is ordered by, and
+// parallel scans keep that order through batch indexes. This optimizer drops ORDER BY on that column (a top-n
+// becomes a plain LIMIT), switching an edge scan to the adjacency list of the requested side when needed.
+class GraphArScanOrder {
+public:
+    static OptimizerExtension GetExtension();
+    static void Optimize(OptimizerExtensionInput& input, unique_ptr<LogicalOperator>& plan);
+};
+
+}  // namespace duckdb
@@ -5,7 +5,6 @@
 #include <duckdb/common/common.hpp>
 #include <duckdb/common/enums/access_mode.hpp>
 #include <duckdb/main/client_context.hpp>
-#include <duckdb/main/client_data.hpp>
 
 #include <graphar/graph_info.h>
 
@@ -14,12 +13,12 @@
 namespace duckdb {
 class GraphArSchemaEntry;
 class GraphArTableEntry;
+class GraphArTransaction;
 
 class GraphArCatalog : public Catalog {
 public:
     explicit GraphArCatalog(AttachedDatabase& db_p, const std::string& path_,
-                            std::shared_ptr<graphar::GraphInfo>& graph_info_, ClientContext& context,
-                            std::string& database_name);
+                            std::shared_ptr<graphar::GraphInfo>& graph_info_, const std::string& database_name);
     ~GraphArCatalog();
 
 public:
@@ -51,21 +50,32 @@ public:
 
     bool InMemory() override;
     string GetDBPath() override;
+    // Removes the graph from the search path of the detaching connection, where the attach appended it
+    void OnDetach(ClientContext& context) override;
 
     const std::string& GetPath() const { return path; }
+    // DuckDB database next to the graph yaml that holds the materialized views of the graph, and its attach name
+    std::string GetCachePath() const;
+    std::string GetCacheName() const { return database_name + "_cache"; }
 
     const std::shared_ptr<graphar::GraphInfo> GetGraphInfo() const { return graph_info; }
 
+    // Only one transaction at a time writes to the graph, from before it reads the counts its writes are based on
+    // until it commits or rolls back; other writers fail instead of waiting, like write-write conflicts in DuckDB
+    void LockWriter(GraphArTransaction& transaction);
+    void UnlockWriter(GraphArTransaction& transaction);
+
 private:
     void DropSchema(ClientContext& context, DropInfo& info) override;
 
 private:
     std::string path;
     std::shared_ptr<graphar::GraphInfo> graph_info;
-    ClientData& client_data;
     std::string database_name;
     unique_ptr<GraphArSchemaEntry> main_schema;
     bool in_memory = true;
+    mutex writer_lock;
+    optional_ptr<GraphArTransaction> writer;
 };
 
 }  // namespace duckdb
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <duckdb/execution/physical_operator.hpp>
+#include <duckdb/planner/operator/logical_extension_operator.hpp>
+
+namespace duckdb {
+class GraphArTableEntry;
+
+// CREATE INDEX on the primary key of a vertex table of an attached graph. It writes the VertexKeyIndex of the key next
+// to the vertex data, which equality filters on the key then use to seek to the vertex; there is no index entry in the
+// catalog, and the index is ignored once the vertices change until it is created again.
+class LogicalGraphArCreateIndex : public LogicalExtensionOperator {
+public:
+    LogicalGraphArCreateIndex(GraphArTableEntry& table, std::string property);
+
+    GraphArTableEntry& table;
+    std::string property;
+
+public:
+    PhysicalOperator& CreatePlan(ClientContext& context, PhysicalPlanGenerator& planner) override;
+    void ResolveTypes() override { types.emplace_back(LogicalType::BIGINT); }
+};
+
+class GraphArCreateIndex : public PhysicalOperator {
+public:
+    GraphArCreateIndex(PhysicalPlan& physical_plan, LogicalOperator& op, GraphArTableEntry& table,
+                       std::string property);
+
+    GraphArTableEntry& table;
+    std::string property;
+
+public:
+    // Source interface
+    SourceResultType GetData(ExecutionContext& context, DataChunk& chunk, OperatorSourceInput& input) const override;
+    bool IsSource() const override { return true; }
+
+    string GetName() const override { return "GRAPHAR_CREATE_INDEX"; }
+};
+
+}  // namespace duckdb
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <duckdb/common/index_vector.hpp>
+#include <duckdb/execution/physical_operator.hpp>
+
+namespace duckdb {
+class GraphArTableEntry;
+
+// INSERT INTO a vertex or edge table of an attached graph. Rows are only appended: vertices get the ids after the
+// last vertex, and edges go to a new delta chunk (see EdgeDelta). The chunks are written to the staging directory of
+// the transaction and only move into the graph on commit.
+class GraphArInsert : public PhysicalOperator {
+public:
+    GraphArInsert(PhysicalPlan& physical_plan, LogicalOperator& op, GraphArTableEntry& table,
+                  physical_index_vector_t<idx_t> column_index_map);
+
+    GraphArTableEntry& table;
+    // for every column of the table, the input column it is inserted from, or an invalid index
+    physical_index_vector_t<idx_t> column_index_map;
+
+public:
+    // Source interface
+    SourceResultType GetData(ExecutionContext& context, DataChunk& chunk, OperatorSourceInput& input) const override;
+    bool IsSource() const override { return true; }
+
+    // Sink interface
+    unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext& context) const override;
+    SinkResultType Sink(ExecutionContext& context, DataChunk& chunk, OperatorSinkInput& input) const override;
+    SinkFinalizeType Finalize(Pipeline& pipeline, Event& event, ClientContext& context,
+                              OperatorSinkFinalizeInput& input) const override;
+    bool IsSink() const override { return true; }
+    bool ParallelSink() const override { return false; }
+    bool SinkOrderDependent() const override { return true; }
+
+    string GetName() const override { return "GRAPHAR_INSERT"; }
+};
+
+}  // namespace duckdb
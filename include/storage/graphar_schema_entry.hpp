@@ -33,6 +33,8 @@ public:
     void DropEntry(ClientContext& context, DropInfo& info) override;
     optional_ptr<CatalogEntry> LookupEntry(CatalogTransaction transaction, const EntryLookupInfo& lookup_info) override;
 
+    GraphArTableSet& GetTables() { return tables; }
+
 private:
     void AlterTable(GraphArTransaction& transaction, RenameTableInfo& info);
     void AlterTable(GraphArTransaction& transaction, RenameColumnInfo& info);
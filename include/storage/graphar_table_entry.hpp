@@ -10,7 +10,7 @@ struct GraphArTableInformation;
 
 class GraphArTableEntry : public TableCatalogEntry {
 public:
-    GraphArTableEntry(Catalog& catalog, unique_ptr<SchemaCatalogEntry> schema, CreateTableInfo& info);
+    GraphArTableEntry(Catalog& catalog, SchemaCatalogEntry& schema, CreateTableInfo& info);
 
 public:
     unique_ptr<BaseStatistics> GetStatistics(ClientContext& context, column_t column_id) override;
@@ -25,9 +25,9 @@ public:
                                ClientContext& context) override;
 
     void SetTableInfo(shared_ptr<GraphArTableInformation> table_info_) { table_info = table_info_; }
+    shared_ptr<GraphArTableInformation> GetTableInfo() const { return table_info.lock(); }
 
 private:
-    unique_ptr<SchemaCatalogEntry> schema;
     weak_ptr<GraphArTableInformation> table_info;
 };
 
@@ -7,22 +7,35 @@
 
 namespace duckdb {
 class GraphArTableSchema;
+class ReadBindData;
 
 enum class GraphArTableType { Vertex, Edge, Unknown };
 
 struct GraphArTableInformation {
 public:
-    GraphArTableInformation(GraphArCatalog& catalog_, unique_ptr<GraphArTableEntry> entry_, const string& name_,
-                            GraphArTableType type_, vector<string>&& params_)
-        : catalog(catalog_), entry(std::move(entry_)), name(name_), type(type_), params(std::move(params_)) {}
+    GraphArTableInformation(GraphArCatalog& catalog_, const string& name_, GraphArTableType type_,
+                            vector<string>&& params_)
+        : catalog(catalog_), name(name_), type(type_), params(std::move(params_)) {}
 
 public:
     optional_ptr<CatalogEntry> GetSchemaVersion(optional_ptr<BoundAtClause> at);
     optional_ptr<CatalogEntry> CreateSchemaVersion(GraphArTableSchema& table_schema);
     const string& BaseFilePath() const;
 
+    // The catalog entry is only built when the table is first looked up
     bool IsFilled() const { return filled; }
-    GraphArTableEntry& GetEntry() const { return *entry; }
+    void SetEntry(unique_ptr<GraphArTableEntry> entry_) {
+        entry = std::move(entry_);
+        filled = true;
+    }
+    GraphArTableEntry& GetEntry() const {
+        D_ASSERT(filled);
+        return *entry;
+    }
+    const string& GetName() const { return name; }
+    // Bind data of a scan of the table, computed with the entry; scans start from a copy of it
+    void SetBindData(shared_ptr<const ReadBindData> bind_data_) { bind_data = std::move(bind_data_); }
+    const ReadBindData& GetBindData() const { return *bind_data; }
     GraphArTableType GetType() const { return type; }
 
     const GraphArCatalog& GetCatalog() const { return catalog; }
@@ -35,5 +48,6 @@ private:
     bool filled = false;
     GraphArTableType type = GraphArTableType::Unknown;
     vector<std::string> params;
+    shared_ptr<const ReadBindData> bind_data;
 };
 }  // namespace duckdb
@@ -26,7 +26,13 @@ public:
     optional_ptr<CatalogEntry> CreateNewEntry(ClientContext& context, Catalog& catalog, GraphArSchemaEntry& schema,
                                               CreateViewInfo& info);
     void LoadEntries(ClientContext& context);
-    void FillEntry(ClientContext& context, GraphArTableInformation& table);
+    void FillEntry(ClientContext& context, const shared_ptr<GraphArTableInformation>& table);
+
+    // View created in the graph, nullptr when there is none with the name
+    shared_ptr<ViewCatalogEntry> GetView(const string& name);
+    // Name of the table in the cache database that holds the rows of the view for the graph files of the fingerprint
+    static string GetMaterializedName(const ViewCatalogEntry& view, hash_t fingerprint);
+    static bool IsMaterializedName(const string& name, const string& view_name);
 
     template <typename InfoVector>
     std::enable_if_t<std::is_same_v<InfoVector, graphar::VertexInfoVector> ||
@@ -34,9 +40,14 @@ public:
                      void>
     CreateTables(GraphArCatalog& graphar_catalog, const InfoVector& infos, GraphArTableType type);
 
+private:
+    optional_ptr<CatalogEntry> GetMaterializedEntry(ClientContext& context, const ViewCatalogEntry& view);
+
 private:
     case_insensitive_map_t<shared_ptr<GraphArTableInformation>> table_entries;
     case_insensitive_map_t<shared_ptr<ViewCatalogEntry>> view_entries;
+    // views reading a materialized table, by the name of the table
+    case_insensitive_map_t<shared_ptr<ViewCatalogEntry>> materialized_entries;
 };
 
 }  // namespace duckdb
@@ -23,12 +23,28 @@ public:
     void DropEntry(CatalogType type, const string& table_name, bool cascade);
     void ClearTableEntry(const string& table_name);
 
+    // Files the transaction writes go below its staging prefix, at the same relative paths as in the graph. The first
+    // call takes the writer lock of the graph, so counts read after it stay valid until the transaction ends.
+    const std::string& GetStagingPrefix();
+    // Path of a graph file as the transaction sees it: the staged file when the transaction wrote one
+    std::string GetFilePath(const std::string& relative_path) const;
+    // Removes a file or directory of the graph on commit, after the staged files moved in
+    void RemoveOnCommit(const std::string& relative_path);
+    bool HasWrites() const { return !staging_prefix.empty(); }
+
     static GraphArTransaction& Get(ClientContext& context, Catalog& catalog);
 
+private:
+    // Replaces the graph files with the staged ones; a file that fails to move undoes the files moved before it
+    void MoveStagedFiles();
+    void EndWrite();
+
 private:
     DatabaseInstance& db;
     GraphArCatalog& graphar_catalog;
     case_insensitive_map_t<unique_ptr<CatalogEntry>> catalog_entries;
+    std::string staging_prefix;
+    std::vector<std::string> removed_paths;
 };
 
 }  // namespace duckdb
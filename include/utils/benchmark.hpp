@@ -27,11 +27,19 @@ struct GraphArSettings {
         Value result;
         (void)context.TryGetCurrentSetting(name, result);
         if (!result.IsNull()) {
-            return !result.IsNull() && result.GetValue<T>();
+            return result.GetValue<T>();
         }
         return T();
     }
 
     static bool is_time_logging(const ClientContext& context) { return get<bool>(context, "graphar_time_logging"); }
+
+    // Partitions each scan thread reads ahead, 0 disables prefetching
+    static idx_t get_prefetch_depth(const ClientContext& context) {
+        return get<idx_t>(context, "graphar_prefetch_depth");
+    }
+    static idx_t get_prefetch_memory_limit(const ClientContext& context) {
+        return DBConfig::ParseMemoryLimit(get<std::string>(context, "graphar_prefetch_memory_limit"));
+    }
 };
 }  // namespace duckdb
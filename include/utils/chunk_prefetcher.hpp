@@ -0,0 +1,43 @@
+#pragma once
+
+#include <duckdb/common/types.hpp>
+#include <duckdb/main/client_context.hpp>
+
+#include <arrow/api.h>
+
+#include <functional>
+
+namespace duckdb {
+
+// The chunk tables of every property group of one partition of a scan
+struct PrefetchedPartition {
+    idx_t partition_index = 0;
+    std::vector<std::shared_ptr<arrow::Table>> tables;
+};
+
+struct ChunkPrefetchState;
+
+// Reads partitions ahead in a task of the DuckDB task scheduler while the scan thread converts the current one, so
+// prefetching only uses threads of the database that are idle. When the task has not started by the time the scan
+// thread needs the partition, the scan thread reads it itself. At most depth partitions are queued, and no further
+// partition is read while the queued tables hold memory_limit bytes or more.
+class ChunkPrefetcher {
+public:
+    // Reads the next partition into its argument; returns false when there is none left
+    using ReadFunction = std::function<bool(PrefetchedPartition&)>;
+
+    ChunkPrefetcher(ClientContext& context, ReadFunction read, idx_t depth, idx_t memory_limit);
+    ~ChunkPrefetcher();
+
+    ChunkPrefetcher(const ChunkPrefetcher&) = delete;
+    ChunkPrefetcher& operator=(const ChunkPrefetcher&) = delete;
+
+    // Waits for the next partition; returns false when the scan is done. Errors of the reads are rethrown here.
+    bool Next(PrefetchedPartition& result);
+
+private:
+    // Shared with the scheduled task, which may outlive the prefetcher when it has not started yet
+    shared_ptr<ChunkPrefetchState> state;
+};
+
+}  // namespace duckdb
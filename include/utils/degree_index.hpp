@@ -0,0 +1,51 @@
+#pragma once
+
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/common/types.hpp>
+
+#include <graphar/graph_info.h>
+#include <graphar/types.h>
+
+namespace duckdb {
+
+class ClientContext;
+
+// Degrees of the vertices of one offset chunk
+struct DegreeSummary {
+    int64_t min = 0;
+    int64_t max = 0;
+    int64_t sum = 0;
+};
+
+// Degrees of the vertices of one ordered adjacency list, stored next to the edge data by graphar_build_degree_index.
+// The file holds a header, the summary and the stamp of every offset chunk, then one int64 degree per vertex. An index
+// is only opened while every offset file still has the size and mtime it was built from.
+class DegreeIndex {
+public:
+    static std::string GetPath(const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& prefix,
+                               graphar::AdjListType adj_list_type);
+    // Writes the index of the adjacency list; returns the number of indexed vertices
+    static idx_t Build(ClientContext& context, const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                       const std::string& prefix, graphar::AdjListType adj_list_type);
+    // Opens the index of the adjacency list, nullptr when it is missing or stale
+    static unique_ptr<DegreeIndex> Open(ClientContext& context, const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                                        const std::string& prefix, graphar::AdjListType adj_list_type);
+
+    idx_t GetVertexCount() const { return vertex_count; }
+    idx_t GetVertexChunkSize() const { return vertex_chunk_size; }
+    const std::vector<DegreeSummary>& GetSummaries() const { return summaries; }
+    DegreeSummary GetSummary() const;
+
+    // Reads the degrees of vertices [begin, begin + count); safe to call from several threads
+    void Read(idx_t begin, idx_t count, int64_t* degrees) const;
+    int64_t GetDegree(idx_t vid) const;
+
+private:
+    unique_ptr<FileHandle> handle;
+    idx_t vertex_count = 0;
+    idx_t vertex_chunk_size = 0;
+    idx_t data_offset = 0;
+    std::vector<DegreeSummary> summaries;
+};
+
+}  // namespace duckdb
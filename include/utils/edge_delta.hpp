@@ -0,0 +1,49 @@
+#pragma once
+
+#include <duckdb/common/types.hpp>
+
+#include <arrow/api.h>
+
+#include <graphar/graph_info.h>
+
+namespace duckdb {
+
+class ClientContext;
+class FileSystem;
+
+// Edges inserted into an attached graph are not merged into the sorted adjacency lists right away: every insert
+// writes its edges unsorted to one delta chunk below the edge prefix, delta/chunk<i>, a Parquet file with the src and
+// dst ids and all properties, and delta/delta_count holds the number of chunks. Scans and adjacency readers read the
+// delta chunks after the sorted base; a checkpoint merges them into the sorted chunks of every adjacency list.
+class EdgeDelta {
+public:
+    // Paths relative to the graph prefix
+    static std::string GetDirectory(const graphar::EdgeInfo& edge_info);
+    static std::string GetChunkPath(const graphar::EdgeInfo& edge_info, idx_t chunk);
+    static std::string GetCountPath(const graphar::EdgeInfo& edge_info);
+
+    // Number of delta chunks of the edges in the graph at the prefix, 0 for remote graphs
+    static idx_t GetChunkNum(FileSystem& fs, const std::string& prefix, const graphar::EdgeInfo& edge_info);
+    // Number of delta edges, read from the Parquet footers of the chunks
+    static idx_t GetRowNum(FileSystem& fs, const std::string& prefix, const graphar::EdgeInfo& edge_info);
+    static std::shared_ptr<arrow::Table> ReadChunk(const std::string& prefix, const graphar::EdgeInfo& edge_info,
+                                                   idx_t chunk);
+    // All delta edges in one table, nullptr when there are none
+    static std::shared_ptr<arrow::Table> Read(FileSystem& fs, const std::string& prefix,
+                                              const graphar::EdgeInfo& edge_info);
+    // The edges of the first chunk_num delta chunks
+    static std::shared_ptr<arrow::Table> Read(const std::string& prefix, const graphar::EdgeInfo& edge_info,
+                                              idx_t chunk_num);
+    static void WriteChunk(FileSystem& fs, const std::shared_ptr<arrow::Table>& table, const std::string& path);
+
+    // Merges the edges of the first chunk_num delta chunks of the graph at the prefix into the sorted chunks of every
+    // adjacency list, and extends the adjacency lists to the vertices appended since they were written. The rewritten
+    // chunks are written with their offsets and counts below output_prefix; nothing is written when there is nothing
+    // to merge or extend. The vertex chunks are merged on the threads of the database. Returns the number of merged
+    // edges.
+    static idx_t Compact(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                         const std::shared_ptr<graphar::EdgeInfo>& edge_info, idx_t chunk_num,
+                         const std::string& output_prefix);
+};
+
+}  // namespace duckdb
@@ -5,18 +5,24 @@
 
 #include <duckdb/common/types.hpp>
 #include <duckdb/common/types/data_chunk.hpp>
+#include <duckdb/common/types/timestamp.hpp>
 #include <duckdb/function/table/arrow/arrow_type_info.hpp>
 #include <duckdb/function/table/arrow/enum/arrow_type_info_type.hpp>
 
 #include <graphar/api/arrow_reader.h>
+#include <graphar/fwd.h>
 #include <graphar/reader_util.h>
 #include <graphar/types.h>
 
+#include <functional>
 #include <iostream>
 #include <math.h>
 
 namespace duckdb {
 
+class ClientContext;
+class FileSystem;
+
 const std::string GID_COLUMN = "grapharId";
 const std::string GID_COLUMN_INTERNAL = "_graphArVertexIndex";
 const std::string SRC_GID_COLUMN = "_graphArSrcIndex";
@@ -89,104 +95,108 @@ static int64_t GetInt64Value(std::shared_ptr<Array> array, int64_t index) {
     return std::static_pointer_cast<arrow::Int64Scalar>(array->GetScalar(index).ValueOrDie())->value;
 }
 
-class MyAdjReaderOrdSrc {
+enum class GraphArDirection { Out, In, Both };
+
+GraphArDirection ParseDirection(const std::string& direction);
+
+// Reads the adjacency of single vertices from one side of the edge: by source (outgoing edges) or by destination
+// (incoming edges). Uses the ordered adjacency list with its offsets when the graph has it; otherwise the edges of
+// any stored adjacency list are loaded once and indexed by the requested side. The requested edge properties are
+// read by property readers seeked alongside the adjacency reader and follow the src and dst columns.
+class MyAdjReader {
 public:
-    MyAdjReaderOrdSrc(const std::shared_ptr<graphar::EdgeInfo> edge_info, const std::string& prefix)
-        : edge_info_(edge_info),
-          prefix_(prefix),
-          reader_(graphar::AdjListArrowChunkReader::Make(edge_info, graphar::AdjListType::ordered_by_source, prefix)
-                      .value()) {}
-    void find_src(graphar::IdType src) {
-        reader_->seek_src(src);
-        std::pair<graphar::IdType, graphar::IdType> range =
-            (graphar::util::GetAdjListOffsetOfVertex(edge_info_, prefix_, graphar::AdjListType::ordered_by_source, src)
-                 .value());
-        auto chunk_size = edge_info_->GetChunkSize();
-        size_ = range.second - range.first;
-        start_ = GetChunkAndOffset(chunk_size, range.first);
-        end_ = GetChunkAndOffset(chunk_size, range.second);
-        if (start_.first == end_.first) {
-            if (start_.second == end_.second) {
-                chunk_count_ = 0;
-            } else {
-                chunk_count_ = 1;
-            }
-        } else {
-            chunk_count_ = end_.first - start_.first;
-            if (end_.second != 0) {
-                chunk_count_++;
-            }
-        }
-        is_empty_ = true;
-    }
+    MyAdjReader(FileSystem& fs, const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& prefix,
+                bool by_source, const std::vector<std::string>& edge_properties = {});
 
-    bool has_next_table() { return chunk_i_ + 1 < chunk_count_; }
+    void find(graphar::IdType vid);
+    std::shared_ptr<arrow::Table> get(int64_t count);
+    bool finish() const { return remaining_ <= 0; }
+    int64_t size() const { return size_; }
+    // Column of the tables returned by get() that holds the reached vertex
+    int neighbour_column() const { return by_source_ ? 1 : 0; }
 
-    bool finish_table() const { return chunk_i_ >= chunk_count_; }
+private:
+    void BuildIndex(FileSystem& fs, graphar::AdjListType adj_list_type);
+    void FindSorted(graphar::IdType vid);
+    std::shared_ptr<arrow::Table> ReadDelta(FileSystem& fs, const std::shared_ptr<arrow::Schema>& schema) const;
+    std::shared_ptr<arrow::Table> Assemble(const std::shared_ptr<arrow::Table>& adj_table,
+                                           const std::vector<std::shared_ptr<arrow::Table>>& property_tables) const;
 
-    std::shared_ptr<arrow::Table> get_table() {
-        auto table = reader_->GetChunk().value();
+private:
+    const std::shared_ptr<graphar::EdgeInfo> edge_info_;
+    const std::string prefix_;
+    const bool by_source_;
+    int64_t size_ = 0;
+    int64_t remaining_ = 0;
+    // requested edge properties and the property group each of them is read from
+    std::vector<std::string> properties_;
+    std::vector<idx_t> property_group_ids_;
+    graphar::PropertyGroupVector property_groups_;
+    std::vector<std::string> column_names_;
+    std::vector<std::string> column_types_;
+    // ordered adjacency list
+    std::shared_ptr<graphar::AdjListArrowChunkReader> reader_;
+    std::vector<std::shared_ptr<graphar::AdjListPropertyArrowChunkReader>> property_readers_;
+    graphar::AdjListType adj_list_type_;
+    graphar::IdType vertex_chunk_size_ = 0;
+    graphar::IdType vertex_chunk_index_ = -1;
+    graphar::IdType vertex_chunk_num_ = 0;
+    std::shared_ptr<arrow::Int64Array> offsets_;
+    std::shared_ptr<arrow::Table> table_;
+    std::vector<std::shared_ptr<arrow::Table>> property_tables_;
+    int64_t offset_ = 0;
+    // in-memory index over an unordered (or opposite side) adjacency list
+    bool indexed_ = false;
+    std::vector<int64_t> index_offsets_;
+    std::shared_ptr<arrow::Table> index_table_;
+    // edges inserted since the last checkpoint, sorted by the side of the reader like the index above
+    std::vector<int64_t> delta_offsets_;
+    std::shared_ptr<arrow::Table> delta_table_;
+    int64_t delta_offset_ = 0;
+    int64_t delta_remaining_ = 0;
+};
 
-        if (chunk_i_ == chunk_count_ - 1 && end_.second != 0) {
-            if (start_.first == end_.first) {
-                return table->Slice(0, end_.second - start_.second);
-            }
-            return table->Slice(0, end_.second);
-        }
-        return table;
-    }
+// Reads the adjacency of single vertices in the given direction; 'both' returns outgoing edges and then incoming ones.
+class MyDirectedAdjReader {
+public:
+    MyDirectedAdjReader(FileSystem& fs, const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& prefix,
+                        GraphArDirection direction, const std::vector<std::string>& edge_properties = {});
 
-    void next_table() {
-        reader_->next_chunk();
-        chunk_i_++;
-    }
+    void find(graphar::IdType vid);
+    std::shared_ptr<arrow::Table> get(int64_t count);
+    bool finish() const;
+    int64_t size() const;
+    // Column of the table last returned by get() that holds the reached vertex
+    int neighbour_column() const { return readers_[current_].neighbour_column(); }
 
-    std::shared_ptr<arrow::Table> get(int64_t count) {
-        if (is_empty_) {
-            table_ = get_table();
-            offset_ = 0;
-            is_empty_ = false;
-        }
+private:
+    std::vector<MyAdjReader> readers_;
+    idx_t current_ = 0;
+};
 
-        auto result = table_->Slice(offset_, count);
-        offset_ += count;
-        if (offset_ >= table_->num_rows()) {
-            if (has_next_table()) {
-                next_table();
-                offset_ = 0;
-            }
-        }
-        return result;
-    }
+// Positional lookup of vertex properties by GraphAr id. The ids of one batch are grouped by vertex chunk, so each
+// chunk is read once per batch, and the last chunk of every property group stays cached between batches.
+class VertexPropertyLookup {
+public:
+    VertexPropertyLookup(const std::shared_ptr<graphar::VertexInfo>& vertex_info, const std::string& prefix,
+                         const std::vector<std::string>& properties);
 
-    bool finish() {
-        if (is_empty_) {
-            if (finish_table()) {
-                return true;
-            }
-            table_ = get_table();
-            offset_ = 0;
-            is_empty_ = false;
-        }
-        if (offset_ >= table_->num_rows()) {
-            return true;
-        }
-        return false;
-    }
+    // One array per property with the values of the given vertices, in the order of ids
+    std::vector<std::shared_ptr<arrow::Array>> Lookup(const std::shared_ptr<arrow::ChunkedArray>& ids);
 
-    int64_t size() { return size_; }
+private:
+    const std::shared_ptr<arrow::Table>& GetChunk(idx_t group_id, graphar::IdType chunk_index);
 
 private:
-    const std::shared_ptr<graphar::EdgeInfo> edge_info_;
-    const std::string prefix_;
-    int64_t size_ = 0;
-    std::shared_ptr<graphar::AdjListArrowChunkReader> reader_;
-    std::pair<int64_t, int64_t> start_;
-    std::pair<int64_t, int64_t> end_;
-    int64_t chunk_count_ = 0, chunk_i_ = 0;
-    int64_t offset_ = 0;
-    std::shared_ptr<arrow::Table> table_;
-    bool is_empty_ = false;
+    std::shared_ptr<graphar::VertexInfo> vertex_info_;
+    std::string prefix_;
+    std::vector<std::string> properties_;
+    std::vector<std::string> types_;
+    std::vector<idx_t> property_group_ids_;
+    graphar::PropertyGroupVector property_groups_;
+    std::vector<std::shared_ptr<graphar::VertexPropertyArrowChunkReader>> readers_;
+    std::vector<graphar::IdType> chunk_indices_;
+    std::vector<std::shared_ptr<arrow::Table>> chunks_;
 };
 
 inline void PrintArrowTable(const std::shared_ptr<arrow::Table>& table, int64_t limit = 0) {
@@ -229,5 +239,44 @@ inline void PrintArrowTable(const std::shared_ptr<arrow::Table>& table, int64_t
 std::string GetYamlContent(const std::string& path);
 std::string GetDirectory(const std::string& path);
 std::int64_t GetCount(const std::string& path);
-std::int64_t GetVertexCount(const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& directory);
+std::int64_t GetVertexCount(const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& directory,
+                            graphar::AdjListType adj_list_type = graphar::AdjListType::ordered_by_source);
+// Vertex chunk size of the side an ordered adjacency list is sorted by
+idx_t GetAdjListVertexChunkSize(const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                                graphar::AdjListType adj_list_type);
+std::shared_ptr<arrow::Int64Array> ReadOffsetChunk(const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                                                   const std::string& prefix, graphar::AdjListType adj_list_type,
+                                                   graphar::IdType vertex_chunk_index);
+std::string GetOffsetChunkPath(const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& prefix,
+                               graphar::AdjListType adj_list_type, graphar::IdType vertex_chunk_index);
+// 0 when an adjacency list is partitioned by the source vertex, 1 by the destination
+idx_t GetAdjListSide(graphar::AdjListType adj_list_type);
+// Count stored in the file at the path, default_value when there is no such file
+int64_t ReadCount(FileSystem& fs, const std::string& path, int64_t default_value);
+// Gathers the columns of the schema from the tables a chunk is stored in
+std::shared_ptr<arrow::Table> AssembleTable(const std::shared_ptr<arrow::Schema>& schema,
+                                            const std::vector<std::shared_ptr<arrow::Table>>& tables);
+void CheckWriteStatus(const graphar::Status& status, const std::string& what);
+// Runs job(0) to job(job_count - 1) as tasks of the DuckDB task scheduler, the calling thread included; the first
+// error is thrown once the jobs are done
+void RunParallel(ClientContext& context, idx_t job_count, const std::function<void(idx_t)>& job);
+// Rows [begin, begin + count) of a Parquet chunk file, decoding only the row groups that hold them
+std::shared_ptr<arrow::Table> ReadParquetRows(const std::string& prefix, const std::string& path, idx_t begin,
+                                              idx_t count);
+
+// Size and modification time of a file; data derived from the file is stale once they change
+struct FileStamp {
+    idx_t size = 0;
+    timestamp_t last_modified;
+
+    bool operator==(const FileStamp& other) const {
+        return size == other.size && last_modified == other.last_modified;
+    }
+    bool operator!=(const FileStamp& other) const { return !(*this == other); }
+};
+
+FileStamp GetFileStamp(ClientContext& context, const std::string& path);
+// Hash of the stamps of the count files of every table of the graph, which every write of a table rewrites; it only
+// stats a few files per table, and leaves out the indexes and caches derived from the data
+hash_t GetGraphFingerprint(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info);
 }  // namespace duckdb
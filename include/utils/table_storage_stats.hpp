@@ -0,0 +1,38 @@
+#pragma once
+
+#include <duckdb/common/types.hpp>
+
+#include <graphar/graph_info.h>
+
+namespace duckdb {
+
+class ClientContext;
+struct FileStamp;
+
+// On-disk size and layout of the vertices of a type or the edges of a triple, read from file metadata only. They are
+// cached for the process while the count files of the table are unchanged, which every write of the table rewrites.
+struct TableStorageStats {
+    // all files below the directory of the table, indexes included
+    idx_t bytes = 0;
+    idx_t files = 0;
+    // chunks of the property groups, adjacency lists and inserted edges, without the offset chunks
+    idx_t chunks = 0;
+    idx_t rows = 0;
+    // one "<prefix> (<file type>): <properties>" per property group, and one per adjacency list of edges
+    std::vector<std::string> layout;
+
+    static TableStorageStats Get(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                 const std::shared_ptr<graphar::VertexInfo>& vertex_info);
+    static TableStorageStats Get(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                 const std::shared_ptr<graphar::EdgeInfo>& edge_info);
+
+    // Stamps of the count files of the table, empty stamps for missing files
+    static std::vector<FileStamp> GetStamps(ClientContext& context,
+                                            const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                            const std::shared_ptr<graphar::VertexInfo>& vertex_info);
+    static std::vector<FileStamp> GetStamps(ClientContext& context,
+                                            const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                            const std::shared_ptr<graphar::EdgeInfo>& edge_info);
+};
+
+}  // namespace duckdb
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/common/types.hpp>
+#include <duckdb/common/types/value.hpp>
+
+#include <graphar/graph_info.h>
+#include <graphar/types.h>
+
+namespace duckdb {
+
+class ClientContext;
+
+// Key to vertex id index of the primary key property of a vertex type, written next to the vertex data by
+// CREATE INDEX on an attached graph. The file holds a header, the stamp of every chunk of the key property group, then
+// the (key, vertex id) pairs sorted by key. Integer keys are stored as they are and string keys as their hash, so a
+// lookup may also return vertices whose key only collides with the searched one: callers keep comparing the keys. An
+// index is only opened while the vertex count and every chunk of the key property group are unchanged.
+class VertexKeyIndex {
+public:
+    static std::string GetPath(const std::shared_ptr<graphar::GraphInfo>& graph_info, const std::string& vertex_type,
+                               const std::string& property);
+    // Primary key property of the vertex type, empty when it has none
+    static std::string GetPrimaryKey(const graphar::VertexInfo& vertex_info);
+    // Writes the index of the property below output_prefix, at its path relative to the graph prefix; returns the
+    // number of indexed vertices
+    static idx_t Build(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                       const std::string& vertex_type, const std::string& property, const std::string& output_prefix);
+    // Opens the index of the property, nullptr when it is missing or stale
+    static unique_ptr<VertexKeyIndex> Open(ClientContext& context,
+                                           const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                           const std::string& vertex_type, const std::string& property);
+
+    // Ids of at most max_count vertices whose key may be equal to the value, in id order
+    std::vector<graphar::IdType> Lookup(const Value& value, idx_t max_count) const;
+
+private:
+    int64_t ReadKey(idx_t entry) const;
+
+private:
+    unique_ptr<FileHandle> handle;
+    uint64_t key_kind = 0;
+    idx_t entry_count = 0;
+    idx_t data_offset = 0;
+};
+
+}  // namespace duckdb
@@ -2,11 +2,18 @@
 
 #include "duckdb_graphar_extension.hpp"
 
+#include "functions/copy/graphar_copy.hpp"
+#include "functions/pragma/build_adj_lists.hpp"
+#include "functions/pragma/materialize_view.hpp"
 #include "functions/scalar/bfs.hpp"
+#include "functions/table/build_degree_index.hpp"
 #include "functions/table/edges_vertex.hpp"
+#include "functions/table/graphar_table_info.hpp"
 #include "functions/table/hop.hpp"
 #include "functions/table/read_edges.hpp"
 #include "functions/table/read_vertices.hpp"
+#include "optimizer/graphar_scan_limit.hpp"
+#include "optimizer/graphar_scan_order.hpp"
 #include "storage/graphar_storage.hpp"
 #include "utils/global_log_manager.hpp"
 
@@ -35,6 +42,12 @@ static void LoadInternal(ExtensionLoader& loader) {
 
     config.AddExtensionOption("graphar_time_logging", "Enable time logging for GraphAr requests.", LogicalType::BOOLEAN,
                               Value::BOOLEAN(false));
+    config.AddExtensionOption("graphar_prefetch_depth",
+                              "Number of GraphAr chunks each scan thread reads ahead in the background (0 to disable).",
+                              LogicalType::UBIGINT, Value::UBIGINT(2));
+    config.AddExtensionOption("graphar_prefetch_memory_limit",
+                              "Memory the chunks read ahead by one scan thread may hold, e.g. '256MB'.",
+                              LogicalType::VARCHAR, Value("256MB"));
 
     GlobalLogManager::Initialize(loader.GetDatabaseInstance());
 
@@ -44,6 +57,15 @@ static void LoadInternal(ExtensionLoader& loader) {
     EdgesVertex::Register(loader);
     TwoHop::Register(loader);
     OneMoreHop::Register(loader);
+    BuildDegreeIndex::Register(loader);
+    GraphArTableInfo::Register(loader);
+    GraphArCopy::Register(loader);
+    BuildAdjLists::Register(loader);
+    MaterializeView::Register(loader);
+
+    config.optimizer_extensions.push_back(GraphArScanOrder::GetExtension());
+    // after the scan order optimizer, which turns top-n over ordered scans into limits
+    config.optimizer_extensions.push_back(GraphArScanLimit::GetExtension());
 
     config.storage_extensions["duckdb_graphar"] = make_uniq<GraphArStorageExtension>();
 }
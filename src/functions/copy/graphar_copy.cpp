@@ -0,0 +1,790 @@
+#include "functions/copy/graphar_copy.hpp"
+
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <arrow/c/bridge.h>
+
+#include <duckdb/common/arrow/arrow_converter.hpp>
+#include <duckdb/common/arrow/arrow_type_extension.hpp>
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/common/string_util.hpp>
+#include <duckdb/common/vector_operations/vector_operations.hpp>
+#include <duckdb/main/client_context.hpp>
+#include <duckdb/main/config.hpp>
+#include <duckdb/parallel/task_scheduler.hpp>
+#include <duckdb/storage/buffer_manager.hpp>
+#include <duckdb/storage/storage_info.hpp>
+
+#include <graphar/fwd.h>
+#include <graphar/general_params.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+
+namespace duckdb {
+
+static constexpr idx_t DEFAULT_VERTEX_CHUNK_SIZE = 1048576;
+static constexpr idx_t DEFAULT_EDGE_CHUNK_SIZE = 4194304;
+
+static std::shared_ptr<graphar::DataType> DuckTypeToGraphArType(const LogicalType& type) {
+    switch (type.id()) {
+        case LogicalTypeId::BOOLEAN:
+            return graphar::boolean();
+        case LogicalTypeId::INTEGER:
+            return graphar::int32();
+        case LogicalTypeId::BIGINT:
+            return graphar::int64();
+        case LogicalTypeId::FLOAT:
+            return graphar::float32();
+        case LogicalTypeId::DOUBLE:
+            return graphar::float64();
+        case LogicalTypeId::VARCHAR:
+            return graphar::string();
+        default:
+            throw BinderException("Columns of type %s cannot be written to GraphAr", type.ToString());
+    }
+}
+
+static std::shared_ptr<const graphar::InfoVersion> GetInfoVersion() {
+    GAR_ASSIGN_OR_RAISE_ERROR(auto version, graphar::InfoVersion::Parse("gar/v1"));
+    return version;
+}
+
+static graphar::PropertyGroupVector MakePropertyGroups(const GraphArCopyBindData& bind_data, idx_t first_column) {
+    std::vector<graphar::Property> properties;
+    for (idx_t i = first_column; i < bind_data.names.size(); ++i) {
+        properties.emplace_back(bind_data.names[i], DuckTypeToGraphArType(bind_data.types[i]),
+                                bind_data.names[i] == bind_data.primary_key);
+    }
+    if (properties.empty()) {
+        return {};
+    }
+    return {graphar::CreatePropertyGroup(properties, graphar::FileType::PARQUET)};
+}
+
+static std::shared_ptr<arrow::RecordBatch> ToRecordBatch(ClientContext& context, const GraphArCopyBindData& bind_data,
+                                                         const std::shared_ptr<arrow::Schema>& schema,
+                                                         DataChunk& chunk) {
+    ArrowArray array;
+    ArrowConverter::ToArrowArray(chunk, &array, context.GetClientProperties(),
+                                 ArrowTypeExtensionData::GetExtensionTypes(context, bind_data.types));
+    auto maybe_batch = arrow::ImportRecordBatch(&array, schema);
+    if (!maybe_batch.ok()) {
+        throw IOException("Failed to convert rows to Arrow: " + maybe_batch.status().message());
+    }
+    return maybe_batch.ValueUnsafe();
+}
+
+//-------------------------------------------------------------------
+// Bind
+//-------------------------------------------------------------------
+unique_ptr<FunctionData> GraphArCopy::Bind(ClientContext& context, CopyFunctionBindInput& input,
+                                           const vector<string>& names, const vector<LogicalType>& sql_types) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArCopy::Bind");
+    auto result = make_uniq<GraphArCopyBindData>();
+    std::string ordered_by = "both";
+    std::string sorted_by;
+    for (const auto& option : input.info.options) {
+        const auto key = StringUtil::Lower(option.first);
+        if (option.second.size() != 1) {
+            throw BinderException("Option '%s' of COPY TO graphar expects a single value", option.first);
+        }
+        const auto& value = option.second[0];
+        if (key == "vertex_type") {
+            result->vertex_type = value.ToString();
+        } else if (key == "edge_type") {
+            result->edge_type = value.ToString();
+        } else if (key == "src_type") {
+            result->src_type = value.ToString();
+        } else if (key == "dst_type") {
+            result->dst_type = value.ToString();
+        } else if (key == "primary_key") {
+            result->primary_key = value.ToString();
+        } else if (key == "graph_name") {
+            result->graph_name = value.ToString();
+        } else if (key == "chunk_size") {
+            const auto chunk_size = value.GetValue<int64_t>();
+            if (chunk_size <= 0) {
+                throw BinderException("chunk_size must be positive");
+            }
+            result->chunk_size = chunk_size;
+        } else if (key == "directed") {
+            result->directed = value.GetValue<bool>();
+        } else if (key == "ordered_by") {
+            ordered_by = StringUtil::Lower(value.ToString());
+        } else if (key == "sorted_by") {
+            sorted_by = StringUtil::Lower(value.ToString());
+        } else {
+            throw NotImplementedException("Unrecognized option for COPY TO graphar: %s", option.first);
+        }
+    }
+
+    if (result->vertex_type.empty() == result->edge_type.empty()) {
+        throw BinderException("COPY TO graphar requires either vertex_type or edge_type");
+    }
+    if (!result->IsEdges()) {
+        if (result->chunk_size == 0) {
+            result->chunk_size = DEFAULT_VERTEX_CHUNK_SIZE;
+        }
+        for (const auto& name : names) {
+            if (name == GID_COLUMN_INTERNAL) {
+                throw BinderException("Column %s is written by GraphAr itself", GID_COLUMN_INTERNAL);
+            }
+        }
+        if (!result->primary_key.empty() &&
+            std::find(names.begin(), names.end(), result->primary_key) == names.end()) {
+            throw BinderException("Primary key %s is not a column of the copied vertices", result->primary_key);
+        }
+        result->names = names;
+        result->types = sql_types;
+        MakePropertyGroups(*result, 0);
+        return std::move(result);
+    }
+
+    if (!result->primary_key.empty()) {
+        throw BinderException("primary_key is only supported for vertices");
+    }
+    if (result->src_type.empty()) {
+        throw BinderException("COPY TO graphar of edges requires src_type");
+    }
+    if (result->dst_type.empty()) {
+        result->dst_type = result->src_type;
+    }
+    if (result->chunk_size == 0) {
+        result->chunk_size = DEFAULT_EDGE_CHUNK_SIZE;
+    }
+    if (!sorted_by.empty()) {
+        if (sorted_by != "src" && sorted_by != "dst") {
+            throw BinderException("sorted_by must be 'src' or 'dst', got '%s'", sorted_by);
+        }
+        // without insertion order the sorted rows reach the writer interleaved from several threads
+        if (!DBConfig::GetConfig(context).options.preserve_insertion_order) {
+            throw BinderException("sorted_by requires preserve_insertion_order, which is disabled");
+        }
+        ordered_by = sorted_by;
+        result->presorted = true;
+    }
+    if (ordered_by == "src" || ordered_by == "both") {
+        result->adj_list_types.push_back(graphar::AdjListType::ordered_by_source);
+    }
+    if (ordered_by == "dst" || ordered_by == "both") {
+        result->adj_list_types.push_back(graphar::AdjListType::ordered_by_dest);
+    }
+    if (result->adj_list_types.empty()) {
+        throw BinderException("ordered_by must be 'src', 'dst' or 'both', got '%s'", ordered_by);
+    }
+    if (names.size() < 2 || !sql_types[0].IsIntegral() || !sql_types[1].IsIntegral()) {
+        throw BinderException("Edges written to GraphAr start with the integer ids of their source and destination");
+    }
+    result->names = {SRC_GID_COLUMN, DST_GID_COLUMN};
+    result->types = {LogicalType::BIGINT, LogicalType::BIGINT};
+    for (idx_t i = 2; i < names.size(); ++i) {
+        result->names.push_back(names[i]);
+        result->types.push_back(sql_types[i]);
+    }
+    MakePropertyGroups(*result, 2);
+    return std::move(result);
+}
+//-------------------------------------------------------------------
+// Init
+//-------------------------------------------------------------------
+static void InitVertices(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate) {
+    gstate.vertex_info =
+        graphar::CreateVertexInfo(bind_data.vertex_type, bind_data.chunk_size, MakePropertyGroups(bind_data, 0), {},
+                                  "vertex/" + bind_data.vertex_type + "/", GetInfoVersion());
+    GAR_ASSIGN_OR_RAISE_ERROR(gstate.vertex_writer,
+                              graphar::VertexPropertyWriter::Make(gstate.vertex_info, gstate.directory));
+}
+
+static bool SameEdgeLayout(const graphar::EdgeInfo& left, const graphar::EdgeInfo& right) {
+    const auto& left_groups = left.GetPropertyGroups();
+    const auto& right_groups = right.GetPropertyGroups();
+    return left.GetChunkSize() == right.GetChunkSize() && left.GetSrcChunkSize() == right.GetSrcChunkSize() &&
+           left.GetDstChunkSize() == right.GetDstChunkSize() && left.IsDirected() == right.IsDirected() &&
+           left.GetPrefix() == right.GetPrefix() && left_groups.size() == right_groups.size() &&
+           std::equal(left_groups.begin(), left_groups.end(), right_groups.begin(),
+                      [](const std::shared_ptr<graphar::PropertyGroup>& a,
+                         const std::shared_ptr<graphar::PropertyGroup>& b) { return *a == *b; });
+}
+
+static void InitEdges(ClientContext& context, const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate) {
+    auto get_vertex_info = [&](const std::string& type) {
+        auto vertex_info = gstate.graph_info ? gstate.graph_info->GetVertexInfo(type) : nullptr;
+        if (!vertex_info) {
+            throw InvalidInputException("Vertices of type '%s' must be copied to '%s' before their edges", type,
+                                        gstate.directory);
+        }
+        return vertex_info;
+    };
+    const auto src_info = get_vertex_info(bind_data.src_type);
+    const auto dst_info = get_vertex_info(bind_data.dst_type);
+
+    graphar::AdjacentListVector adjacent_lists;
+    for (auto type : bind_data.adj_list_types) {
+        adjacent_lists.push_back(graphar::CreateAdjacentList(type, graphar::FileType::PARQUET));
+    }
+    const auto name = bind_data.src_type + "_" + bind_data.edge_type + "_" + bind_data.dst_type;
+    gstate.edge_info = graphar::CreateEdgeInfo(bind_data.src_type, bind_data.edge_type, bind_data.dst_type,
+                                               bind_data.chunk_size, src_info->GetChunkSize(), dst_info->GetChunkSize(),
+                                               bind_data.directed, adjacent_lists, MakePropertyGroups(bind_data, 2),
+                                               "edge/" + name + "/", GetInfoVersion());
+    // the other adjacency lists of the type stay when they have the same layout, so that separate statements can
+    // write the lists of one type
+    const auto old_info = gstate.graph_info->GetEdgeInfo(bind_data.src_type, bind_data.edge_type, bind_data.dst_type);
+    if (old_info && SameEdgeLayout(*old_info, *gstate.edge_info)) {
+        for (auto type : {graphar::AdjListType::ordered_by_source, graphar::AdjListType::ordered_by_dest}) {
+            if (old_info->HasAdjacentListType(type) && !gstate.edge_info->HasAdjacentListType(type)) {
+                GAR_ASSIGN_OR_RAISE_ERROR(gstate.edge_info,
+                                          gstate.edge_info->AddAdjacentList(old_info->GetAdjacentList(type)));
+            }
+        }
+    }
+
+    for (auto type : bind_data.adj_list_types) {
+        const bool by_dest = type == graphar::AdjListType::ordered_by_dest;
+        GraphArCopyAdjList adj_list;
+        adj_list.type = type;
+        adj_list.id_column = by_dest ? 1 : 0;
+        adj_list.vertex_count =
+            GraphArFunctions::GetVertexNum(gstate.graph_info, by_dest ? bind_data.dst_type : bind_data.src_type);
+        adj_list.vertex_chunk_size = (by_dest ? dst_info : src_info)->GetChunkSize();
+        GAR_ASSIGN_OR_RAISE_ERROR(adj_list.writer,
+                                  graphar::EdgeChunkWriter::Make(gstate.edge_info, gstate.directory, type));
+        adj_list.partitions.resize((adj_list.vertex_count + adj_list.vertex_chunk_size - 1) /
+                                   adj_list.vertex_chunk_size);
+        gstate.adj_lists.push_back(std::move(adj_list));
+    }
+}
+
+unique_ptr<GlobalFunctionData> GraphArCopy::InitGlobal(ClientContext& context, FunctionData& bind_data_p,
+                                                       const string& file_path) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArCopy::InitGlobal");
+    auto& bind_data = bind_data_p.Cast<GraphArCopyBindData>();
+    auto result = make_uniq<GraphArCopyGlobalState>();
+    auto& gstate = *result;
+
+    auto& fs = FileSystem::GetFileSystem(context);
+    // GraphAr prefixes have to be absolute
+    gstate.directory = FileSystem::IsRemoteFile(file_path) ? file_path : std::filesystem::absolute(file_path).string();
+    if (!StringUtil::EndsWith(gstate.directory, "/")) {
+        gstate.directory += "/";
+    }
+    if (!fs.DirectoryExists(gstate.directory)) {
+        fs.CreateDirectory(gstate.directory);
+    }
+    const auto graph_path = gstate.directory + bind_data.graph_name + ".graph.yaml";
+    if (fs.FileExists(graph_path)) {
+        auto maybe_graph_info = graphar::GraphInfo::Load(graph_path);
+        if (maybe_graph_info.has_error()) {
+            throw IOException("Failed to load graph info from path: %s", graph_path);
+        }
+        gstate.graph_info = maybe_graph_info.value();
+    }
+
+    ArrowSchema schema;
+    auto properties = context.GetClientProperties();
+    ArrowConverter::ToArrowSchema(&schema, bind_data.types, bind_data.names, properties);
+    auto maybe_schema = arrow::ImportSchema(&schema);
+    if (!maybe_schema.ok()) {
+        throw IOException("Failed to import Arrow schema: " + maybe_schema.status().message());
+    }
+    gstate.schema = maybe_schema.ValueUnsafe();
+
+    if (bind_data.IsEdges()) {
+        InitEdges(context, bind_data, gstate);
+    } else {
+        InitVertices(bind_data, gstate);
+    }
+    return std::move(result);
+}
+
+unique_ptr<LocalFunctionData> GraphArCopy::InitLocal(ExecutionContext& context, FunctionData& bind_data) {
+    return make_uniq<GraphArCopyLocalState>();
+}
+//-------------------------------------------------------------------
+// Chunks
+//-------------------------------------------------------------------
+static vector<std::shared_ptr<arrow::RecordBatch>> TableToBatches(const arrow::Table& table) {
+    arrow::TableBatchReader reader(table);
+    vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    auto status = reader.ReadAll(&batches);
+    if (!status.ok()) {
+        throw IOException("Failed to read Arrow rows: " + status.message());
+    }
+    return batches;
+}
+
+// Passes the complete chunks of the pending rows to write, and on the last call the partial chunk left
+static void WritePendingChunks(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate, bool last,
+                               const std::function<void(const std::shared_ptr<arrow::Table>&)>& write) {
+    while (gstate.pending_rows >= bind_data.chunk_size || (last && gstate.pending_rows > 0)) {
+        auto maybe_table = arrow::Table::FromRecordBatches(gstate.schema, gstate.pending);
+        if (!maybe_table.ok()) {
+            throw IOException("Failed to build chunk: " + maybe_table.status().message());
+        }
+        auto table = maybe_table.ValueUnsafe();
+        const idx_t rows = std::min(bind_data.chunk_size, gstate.pending_rows);
+        write(table->Slice(0, rows));
+        gstate.chunk_index++;
+        gstate.pending_rows -= rows;
+        gstate.pending.clear();
+        if (gstate.pending_rows > 0) {
+            gstate.pending = TableToBatches(*table->Slice(rows));
+        }
+    }
+}
+//-------------------------------------------------------------------
+// Vertices
+//-------------------------------------------------------------------
+static void WriteVertexChunks(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate, bool last) {
+    WritePendingChunks(bind_data, gstate, last, [&](const std::shared_ptr<arrow::Table>& chunk) {
+        CheckWriteStatus(gstate.vertex_writer->WriteTable(chunk, gstate.chunk_index),
+                         "vertex chunk " + std::to_string(gstate.chunk_index));
+        DUCKDB_GRAPHAR_LOG_DEBUG("Wrote vertex chunk " + std::to_string(gstate.chunk_index));
+        gstate.vertex_count += chunk->num_rows();
+    });
+}
+
+static void AppendVertices(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate,
+                           const std::shared_ptr<arrow::Table>& table) {
+    for (auto& batch : TableToBatches(*table)) {
+        gstate.pending_rows += batch->num_rows();
+        gstate.pending.push_back(std::move(batch));
+    }
+    WriteVertexChunks(bind_data, gstate, false);
+}
+//-------------------------------------------------------------------
+// Edges
+//-------------------------------------------------------------------
+static void CastEdgeIds(ClientContext& context, const GraphArCopyBindData& bind_data, DataChunk& input,
+                        DataChunk& result) {
+    result.Initialize(Allocator::Get(context), bind_data.types);
+    for (idx_t col = 0; col < input.ColumnCount(); ++col) {
+        if (input.data[col].GetType() == bind_data.types[col]) {
+            result.data[col].Reference(input.data[col]);
+        } else {
+            VectorOperations::Cast(context, input.data[col], result.data[col], input.size());
+        }
+    }
+    result.SetCardinality(input.size());
+}
+
+static void CheckEdgeId(const GraphArCopyBindData& bind_data, const GraphArCopyAdjList& adj_list, int64_t id) {
+    if (id < 0 || static_cast<idx_t>(id) >= adj_list.vertex_count) {
+        throw InvalidInputException("Edge %s %lld is not a vertex id", bind_data.names[adj_list.id_column], id);
+    }
+}
+
+// Splits the rows by the vertex chunk of their id for every adjacency list; the collections are buffer managed, so
+// they spill to disk under memory pressure
+static void PartitionEdges(ClientContext& context, const GraphArCopyBindData& bind_data,
+                           GraphArCopyGlobalState& gstate, DataChunk& input,
+                           vector<vector<unique_ptr<ColumnDataCollection>>>& partitions) {
+    const idx_t count = input.size();
+    DataChunk chunk;
+    CastEdgeIds(context, bind_data, input, chunk);
+
+    partitions.resize(gstate.adj_lists.size());
+    vector<idx_t> row_partitions(count);
+    for (idx_t adj_i = 0; adj_i < gstate.adj_lists.size(); ++adj_i) {
+        const auto& adj_list = gstate.adj_lists[adj_i];
+        partitions[adj_i].resize(adj_list.partitions.size());
+        UnifiedVectorFormat ids;
+        chunk.data[adj_list.id_column].ToUnifiedFormat(count, ids);
+        const auto id_data = UnifiedVectorFormat::GetData<int64_t>(ids);
+        std::unordered_map<idx_t, std::pair<SelectionVector, idx_t>> selections;
+        for (idx_t row = 0; row < count; ++row) {
+            const auto idx = ids.sel->get_index(row);
+            if (!ids.validity.RowIsValid(idx)) {
+                throw InvalidInputException("Edges written to GraphAr must not have NULL ids");
+            }
+            const auto id = id_data[idx];
+            CheckEdgeId(bind_data, adj_list, id);
+            auto& selection = selections[id / adj_list.vertex_chunk_size];
+            if (selection.second == 0) {
+                selection.first.Initialize(STANDARD_VECTOR_SIZE);
+            }
+            selection.first.set_index(selection.second++, row);
+        }
+        for (auto& entry : selections) {
+            DataChunk slice;
+            slice.InitializeEmpty(bind_data.types);
+            slice.Slice(chunk, entry.second.first, entry.second.second);
+            auto& collection = partitions[adj_i][entry.first];
+            if (!collection) {
+                collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), bind_data.types);
+            }
+            collection->Append(slice);
+        }
+    }
+}
+
+static void MergePartitions(GraphArCopyGlobalState& gstate,
+                            vector<vector<unique_ptr<ColumnDataCollection>>>& partitions) {
+    std::lock_guard<std::mutex> guard(gstate.lock);
+    for (idx_t adj_i = 0; adj_i < partitions.size(); ++adj_i) {
+        for (idx_t vertex_chunk = 0; vertex_chunk < partitions[adj_i].size(); ++vertex_chunk) {
+            auto& collection = partitions[adj_i][vertex_chunk];
+            if (collection) {
+                gstate.adj_lists[adj_i].partitions[vertex_chunk].push_back(std::move(collection));
+            }
+        }
+    }
+    partitions.clear();
+}
+
+// Sorts the edges of one vertex chunk and writes their adjacency list, property, offset and count files
+static void WriteEdgePartition(ClientContext& context, const GraphArCopyBindData& bind_data,
+                               GraphArCopyGlobalState& gstate, GraphArCopyAdjList& adj_list, idx_t vertex_chunk) {
+    vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    idx_t edge_count = 0;
+    for (auto& collection : adj_list.partitions[vertex_chunk]) {
+        for (auto& chunk : collection->Chunks()) {
+            batches.push_back(ToRecordBatch(context, bind_data, gstate.schema, chunk));
+            edge_count += chunk.size();
+        }
+        collection.reset();
+    }
+    auto maybe_table = arrow::Table::FromRecordBatches(gstate.schema, batches);
+    if (!maybe_table.ok()) {
+        throw IOException("Failed to build edge chunk: " + maybe_table.status().message());
+    }
+    const auto what = std::string(AdjListTypeToString(adj_list.type)) + " edges of vertex chunk " +
+                      std::to_string(vertex_chunk);
+    CheckWriteStatus(adj_list.writer->SortAndWriteAdjListTable(maybe_table.ValueUnsafe(), vertex_chunk, 0), what);
+    CheckWriteStatus(adj_list.writer->WriteEdgesNum(vertex_chunk, edge_count), what);
+}
+
+// Memory a vertex chunk takes outside the buffer manager while it is written: its rows as an Arrow table and the
+// sorted copy GraphAr makes of them
+static idx_t GetEdgePartitionMemory(const GraphArCopyAdjList& adj_list, idx_t vertex_chunk) {
+    idx_t size = 0;
+    for (const auto& collection : adj_list.partitions[vertex_chunk]) {
+        size += collection->SizeInBytes();
+    }
+    return 2 * size;
+}
+
+// Reserves the memory of a vertex chunk from the buffer manager while it is written, so that it counts against the
+// memory limit and the buffer manager evicts the collections of the other chunks to make room
+class EdgePartitionReservation {
+public:
+    EdgePartitionReservation(BufferManager& buffer_manager, idx_t size) : buffer_manager(buffer_manager), size(size) {
+        buffer_manager.ReserveMemory(size);
+    }
+    ~EdgePartitionReservation() { buffer_manager.FreeReservedMemory(size); }
+
+private:
+    BufferManager& buffer_manager;
+    idx_t size;
+};
+
+struct EdgePartitionJob {
+    idx_t adj_i;
+    idx_t vertex_chunk;
+    idx_t memory;
+};
+
+static void WriteEdges(ClientContext& context, const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate) {
+    vector<EdgePartitionJob> jobs;
+    for (idx_t adj_i = 0; adj_i < gstate.adj_lists.size(); ++adj_i) {
+        auto& adj_list = gstate.adj_lists[adj_i];
+        CheckWriteStatus(adj_list.writer->WriteVerticesNum(adj_list.vertex_count), "vertex count");
+        for (idx_t vertex_chunk = 0; vertex_chunk < adj_list.partitions.size(); ++vertex_chunk) {
+            jobs.push_back({adj_i, vertex_chunk, GetEdgePartitionMemory(adj_list, vertex_chunk)});
+        }
+    }
+    // every vertex chunk is sorted and written on its own, so they are spread over the threads of the database; a
+    // wave runs at most one chunk per thread and, unless it holds a single chunk, at most half the memory limit
+    auto& buffer_manager = BufferManager::GetBufferManager(context);
+    const idx_t threads = static_cast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+    const idx_t memory_budget = buffer_manager.GetMaxMemory() / 2;
+    idx_t begin = 0;
+    while (begin < jobs.size()) {
+        idx_t end = begin;
+        idx_t wave_memory = 0;
+        while (end < jobs.size() && end - begin < threads &&
+               (end == begin || wave_memory + jobs[end].memory <= memory_budget)) {
+            wave_memory += jobs[end].memory;
+            end++;
+        }
+        DUCKDB_GRAPHAR_LOG_DEBUG("Writing " + std::to_string(end - begin) + " vertex chunks with " +
+                                 std::to_string(wave_memory) + " bytes reserved");
+        RunParallel(context, end - begin, [&](idx_t job) {
+            const auto& entry = jobs[begin + job];
+            EdgePartitionReservation reservation(buffer_manager, entry.memory);
+            WriteEdgePartition(context, bind_data, gstate, gstate.adj_lists[entry.adj_i], entry.vertex_chunk);
+        });
+        begin = end;
+    }
+}
+//-------------------------------------------------------------------
+// Presorted edges
+//-------------------------------------------------------------------
+static std::shared_ptr<arrow::RecordBatch> SortedEdgesToRecordBatch(ClientContext& context,
+                                                                    const GraphArCopyBindData& bind_data,
+                                                                    GraphArCopyGlobalState& gstate, DataChunk& input) {
+    DataChunk chunk;
+    CastEdgeIds(context, bind_data, input, chunk);
+    return ToRecordBatch(context, bind_data, gstate.schema, chunk);
+}
+
+static void WriteSortedEdgeChunks(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate, bool last) {
+    auto& adj_list = gstate.adj_lists[0];
+    WritePendingChunks(bind_data, gstate, last, [&](const std::shared_ptr<arrow::Table>& chunk) {
+        CheckWriteStatus(adj_list.writer->WriteTable(chunk, gstate.vertex_chunk, gstate.chunk_index),
+                         "edge chunk " + std::to_string(gstate.chunk_index) + " of vertex chunk " +
+                             std::to_string(gstate.vertex_chunk));
+    });
+}
+
+// Writes the last edges of the current vertex chunk, then its offsets from the degrees counted while streaming
+static void FinishSortedVertexChunk(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate) {
+    auto& adj_list = gstate.adj_lists[0];
+    WriteSortedEdgeChunks(bind_data, gstate, true);
+    arrow::Int64Builder builder;
+    int64_t offset = 0;
+    auto status = builder.Reserve(gstate.degrees.size() + 1);
+    builder.UnsafeAppend(offset);
+    for (const auto degree : gstate.degrees) {
+        offset += degree;
+        builder.UnsafeAppend(offset);
+    }
+    std::shared_ptr<arrow::Array> offsets;
+    if (status.ok()) {
+        status = builder.Finish(&offsets);
+    }
+    if (!status.ok()) {
+        throw IOException("Failed to build offsets: " + status.message());
+    }
+    const auto what = "offsets of vertex chunk " + std::to_string(gstate.vertex_chunk);
+    const auto offset_table = arrow::Table::Make(
+        arrow::schema({arrow::field(graphar::GeneralParams::kOffsetCol, arrow::int64())}), {offsets});
+    CheckWriteStatus(adj_list.writer->WriteOffsetChunk(offset_table, gstate.vertex_chunk), what);
+    CheckWriteStatus(adj_list.writer->WriteEdgesNum(gstate.vertex_chunk, gstate.edge_count), what);
+    gstate.chunk_index = 0;
+    gstate.edge_count = 0;
+}
+
+// Moves on to a vertex chunk, finishing the current one and the ones without edges in between
+static void StartSortedVertexChunk(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate,
+                                   int64_t vertex_chunk) {
+    const auto& adj_list = gstate.adj_lists[0];
+    while (gstate.vertex_chunk < vertex_chunk) {
+        if (gstate.vertex_chunk >= 0) {
+            FinishSortedVertexChunk(bind_data, gstate);
+        }
+        gstate.vertex_chunk++;
+        const idx_t begin = gstate.vertex_chunk * adj_list.vertex_chunk_size;
+        gstate.degrees.assign(std::min(adj_list.vertex_chunk_size, adj_list.vertex_count - begin), 0);
+    }
+}
+
+// Appends edges that continue the sorted input, writing every edge chunk and vertex chunk as soon as it is complete
+static void AppendSortedEdges(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate,
+                              const std::shared_ptr<arrow::RecordBatch>& batch) {
+    const auto& adj_list = gstate.adj_lists[0];
+    const auto ids = std::static_pointer_cast<arrow::Int64Array>(batch->column(adj_list.id_column));
+    auto append_pending = [&](int64_t begin, int64_t end) {
+        if (end > begin) {
+            gstate.pending.push_back(batch->Slice(begin, end - begin));
+            gstate.pending_rows += end - begin;
+        }
+    };
+    int64_t run_begin = 0;
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+        if (ids->IsNull(row)) {
+            throw InvalidInputException("Edges written to GraphAr must not have NULL ids");
+        }
+        const auto id = ids->Value(row);
+        CheckEdgeId(bind_data, adj_list, id);
+        if (id < gstate.last_id) {
+            throw InvalidInputException("COPY TO graphar with sorted_by got %s %lld after %lld, so it is not sorted",
+                                        bind_data.names[adj_list.id_column], id, gstate.last_id);
+        }
+        gstate.last_id = id;
+        const int64_t vertex_chunk = id / adj_list.vertex_chunk_size;
+        if (vertex_chunk != gstate.vertex_chunk) {
+            append_pending(run_begin, row);
+            run_begin = row;
+            StartSortedVertexChunk(bind_data, gstate, vertex_chunk);
+        }
+        gstate.degrees[id - vertex_chunk * adj_list.vertex_chunk_size]++;
+        gstate.edge_count++;
+    }
+    append_pending(run_begin, batch->num_rows());
+    WriteSortedEdgeChunks(bind_data, gstate, false);
+}
+
+static void FinishSortedEdges(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate) {
+    auto& adj_list = gstate.adj_lists[0];
+    CheckWriteStatus(adj_list.writer->WriteVerticesNum(adj_list.vertex_count), "vertex count");
+    StartSortedVertexChunk(bind_data, gstate, static_cast<int64_t>(adj_list.partitions.size()) - 1);
+    if (gstate.vertex_chunk >= 0) {
+        FinishSortedVertexChunk(bind_data, gstate);
+    }
+}
+//-------------------------------------------------------------------
+// Sink
+//-------------------------------------------------------------------
+void GraphArCopy::Sink(ExecutionContext& context, FunctionData& bind_data_p, GlobalFunctionData& gstate_p,
+                       LocalFunctionData& lstate_p, DataChunk& input) {
+    auto& bind_data = bind_data_p.Cast<GraphArCopyBindData>();
+    auto& gstate = gstate_p.Cast<GraphArCopyGlobalState>();
+    if (bind_data.presorted) {
+        auto batch = SortedEdgesToRecordBatch(context.client, bind_data, gstate, input);
+        std::lock_guard<std::mutex> guard(gstate.lock);
+        AppendSortedEdges(bind_data, gstate, batch);
+        return;
+    }
+    if (bind_data.IsEdges()) {
+        PartitionEdges(context.client, bind_data, gstate, input, lstate_p.Cast<GraphArCopyLocalState>().partitions);
+        return;
+    }
+    auto batch = ToRecordBatch(context.client, bind_data, gstate.schema, input);
+    std::lock_guard<std::mutex> guard(gstate.lock);
+    gstate.pending_rows += batch->num_rows();
+    gstate.pending.push_back(std::move(batch));
+    WriteVertexChunks(bind_data, gstate, false);
+}
+
+void GraphArCopy::Combine(ExecutionContext& context, FunctionData& bind_data, GlobalFunctionData& gstate,
+                          LocalFunctionData& lstate) {
+    MergePartitions(gstate.Cast<GraphArCopyGlobalState>(), lstate.Cast<GraphArCopyLocalState>().partitions);
+}
+//-------------------------------------------------------------------
+// Batches
+//-------------------------------------------------------------------
+CopyFunctionExecutionMode GraphArCopy::ExecutionMode(bool preserve_insertion_order, bool supports_batch_index) {
+    // vertex ids are the positions of the rows and presorted edges are streamed, so the rows are written in order
+    // whenever the order is preserved
+    if (!preserve_insertion_order) {
+        return CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
+    }
+    return supports_batch_index ? CopyFunctionExecutionMode::BATCH_COPY_TO_FILE
+                                : CopyFunctionExecutionMode::REGULAR_COPY_TO_FILE;
+}
+
+unique_ptr<PreparedBatchData> GraphArCopy::PrepareBatch(ClientContext& context, FunctionData& bind_data_p,
+                                                        GlobalFunctionData& gstate_p,
+                                                        unique_ptr<ColumnDataCollection> collection) {
+    auto& bind_data = bind_data_p.Cast<GraphArCopyBindData>();
+    auto& gstate = gstate_p.Cast<GraphArCopyGlobalState>();
+    auto result = make_uniq<GraphArCopyPreparedBatch>();
+    if (bind_data.IsEdges() && !bind_data.presorted) {
+        // edges are sorted at the end, their batches only have to be partitioned
+        vector<vector<unique_ptr<ColumnDataCollection>>> partitions;
+        for (auto& chunk : collection->Chunks()) {
+            PartitionEdges(context, bind_data, gstate, chunk, partitions);
+        }
+        MergePartitions(gstate, partitions);
+        return std::move(result);
+    }
+    vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    for (auto& chunk : collection->Chunks()) {
+        batches.push_back(bind_data.presorted ? SortedEdgesToRecordBatch(context, bind_data, gstate, chunk)
+                                              : ToRecordBatch(context, bind_data, gstate.schema, chunk));
+    }
+    auto maybe_table = arrow::Table::FromRecordBatches(gstate.schema, batches);
+    if (!maybe_table.ok()) {
+        throw IOException("Failed to build batch: " + maybe_table.status().message());
+    }
+    result->table = maybe_table.ValueUnsafe();
+    return std::move(result);
+}
+
+void GraphArCopy::FlushBatch(ClientContext& context, FunctionData& bind_data_p, GlobalFunctionData& gstate_p,
+                             PreparedBatchData& batch) {
+    auto& bind_data = bind_data_p.Cast<GraphArCopyBindData>();
+    auto& table = batch.Cast<GraphArCopyPreparedBatch>().table;
+    if (!table) {
+        return;
+    }
+    auto& gstate = gstate_p.Cast<GraphArCopyGlobalState>();
+    std::lock_guard<std::mutex> guard(gstate.lock);
+    if (!bind_data.presorted) {
+        AppendVertices(bind_data, gstate, table);
+        return;
+    }
+    for (const auto& record_batch : TableToBatches(*table)) {
+        AppendSortedEdges(bind_data, gstate, record_batch);
+    }
+}
+
+idx_t GraphArCopy::DesiredBatchSize(ClientContext& context, FunctionData& bind_data_p) {
+    auto& bind_data = bind_data_p.Cast<GraphArCopyBindData>();
+    return bind_data.IsEdges() ? DEFAULT_ROW_GROUP_SIZE : bind_data.chunk_size;
+}
+//-------------------------------------------------------------------
+// Finalize
+//-------------------------------------------------------------------
+// Writes the yaml of the written type and a graph yaml with it in place of a former type of the same name
+static void SaveGraphInfo(const GraphArCopyBindData& bind_data, GraphArCopyGlobalState& gstate) {
+    graphar::VertexInfoVector vertex_infos;
+    graphar::EdgeInfoVector edge_infos;
+    if (gstate.graph_info) {
+        for (const auto& info : gstate.graph_info->GetVertexInfos()) {
+            if (!gstate.vertex_info || info->GetType() != gstate.vertex_info->GetType()) {
+                vertex_infos.push_back(info);
+            }
+        }
+        for (const auto& info : gstate.graph_info->GetEdgeInfos()) {
+            if (!gstate.edge_info ||
+                GraphArFunctions::GetNameFromInfo(info) != GraphArFunctions::GetNameFromInfo(gstate.edge_info)) {
+                edge_infos.push_back(info);
+            }
+        }
+    }
+    if (gstate.vertex_info) {
+        vertex_infos.push_back(gstate.vertex_info);
+        CheckWriteStatus(gstate.vertex_info->Save(gstate.directory + gstate.vertex_info->GetType() + ".vertex.yaml"),
+                         "vertex yaml");
+    }
+    if (gstate.edge_info) {
+        edge_infos.push_back(gstate.edge_info);
+        const auto edge_path = gstate.directory + GraphArFunctions::GetNameFromInfo(gstate.edge_info) + ".edge.yaml";
+        CheckWriteStatus(gstate.edge_info->Save(edge_path), "edge yaml");
+    }
+    auto graph_info = graphar::CreateGraphInfo(bind_data.graph_name, vertex_infos, edge_infos, {}, gstate.directory,
+                                               GetInfoVersion());
+    CheckWriteStatus(graph_info->Save(gstate.directory + bind_data.graph_name + ".graph.yaml"), "graph yaml");
+}
+
+void GraphArCopy::Finalize(ClientContext& context, FunctionData& bind_data_p, GlobalFunctionData& gstate_p) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArCopy::Finalize");
+    auto& bind_data = bind_data_p.Cast<GraphArCopyBindData>();
+    auto& gstate = gstate_p.Cast<GraphArCopyGlobalState>();
+    if (bind_data.presorted) {
+        std::lock_guard<std::mutex> guard(gstate.lock);
+        FinishSortedEdges(bind_data, gstate);
+    } else if (bind_data.IsEdges()) {
+        WriteEdges(context, bind_data, gstate);
+    } else {
+        std::lock_guard<std::mutex> guard(gstate.lock);
+        WriteVertexChunks(bind_data, gstate, true);
+        CheckWriteStatus(gstate.vertex_writer->WriteVerticesNum(gstate.vertex_count), "vertex count");
+    }
+    SaveGraphInfo(bind_data, gstate);
+}
+//-------------------------------------------------------------------
+// Register
+//-------------------------------------------------------------------
+CopyFunction GraphArCopy::GetFunction() {
+    CopyFunction function("graphar");
+    function.copy_to_bind = Bind;
+    function.copy_to_initialize_global = InitGlobal;
+    function.copy_to_initialize_local = InitLocal;
+    function.copy_to_sink = Sink;
+    function.copy_to_combine = Combine;
+    function.copy_to_finalize = Finalize;
+    function.execution_mode = ExecutionMode;
+    function.prepare_batch = PrepareBatch;
+    function.flush_batch = FlushBatch;
+    function.desired_batch_size = DesiredBatchSize;
+    return function;
+}
+
+void GraphArCopy::Register(ExtensionLoader& loader) { loader.RegisterFunction(GetFunction()); }
+}  // namespace duckdb
@@ -0,0 +1,57 @@
+#include "functions/pragma/build_adj_lists.hpp"
+
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/common/string_util.hpp>
+#include <duckdb/parser/keyword_helper.hpp>
+#include <duckdb/parser/qualified_name.hpp>
+
+namespace duckdb {
+
+string BuildAdjLists::Query(ClientContext& context, const FunctionParameters& parameters) {
+    DUCKDB_GRAPHAR_LOG_TRACE("BuildAdjLists::Query");
+    const auto directory = StringValue::Get(parameters.values[0]);
+    const auto relation = QualifiedName::Parse(StringValue::Get(parameters.values[1]));
+    const auto edge_type = StringValue::Get(parameters.values[2]);
+    const auto src_type = StringValue::Get(parameters.values[3]);
+    auto dst_type = src_type;
+    string extra_options;
+    for (const auto& parameter : parameters.named_parameters) {
+        if (parameter.first == "dst_type") {
+            dst_type = StringValue::Get(parameter.second);
+        } else if (parameter.first == "chunk_size") {
+            extra_options += ", chunk_size " + std::to_string(parameter.second.GetValue<int64_t>());
+        }
+    }
+
+    string from;
+    if (!relation.catalog.empty()) {
+        from += KeywordHelper::WriteOptionallyQuoted(relation.catalog) + ".";
+    }
+    if (!relation.schema.empty()) {
+        from += KeywordHelper::WriteOptionallyQuoted(relation.schema) + ".";
+    }
+    from += KeywordHelper::WriteOptionallyQuoted(relation.name);
+    const auto options = "FORMAT graphar, edge_type " + KeywordHelper::WriteQuoted(edge_type) + ", src_type " +
+                         KeywordHelper::WriteQuoted(src_type) + ", dst_type " + KeywordHelper::WriteQuoted(dst_type) +
+                         extra_options;
+    // the ORDER BY is sorted by DuckDB in parallel; the edges of a vertex come ordered by their other end
+    string result;
+    for (const auto& list : {std::make_pair("src", "1, 2"), std::make_pair("dst", "2, 1")}) {
+        result += StringUtil::Format("COPY (SELECT * FROM %s ORDER BY %s) TO %s (%s, sorted_by '%s');", from,
+                                     list.second, KeywordHelper::WriteQuoted(directory), options, list.first);
+    }
+    return result;
+}
+
+PragmaFunction BuildAdjLists::GetFunction() {
+    auto function = PragmaFunction::PragmaCall(
+        "graphar_build_adj_lists", Query,
+        {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR});
+    function.named_parameters["dst_type"] = LogicalType::VARCHAR;
+    function.named_parameters["chunk_size"] = LogicalType::BIGINT;
+    return function;
+}
+
+void BuildAdjLists::Register(ExtensionLoader& loader) { loader.RegisterFunction(GetFunction()); }
+}  // namespace duckdb
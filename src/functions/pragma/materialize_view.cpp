@@ -0,0 +1,60 @@
+#include "functions/pragma/materialize_view.hpp"
+
+#include "storage/graphar_catalog.hpp"
+#include "storage/graphar_schema_entry.hpp"
+#include "storage/graphar_table_set.hpp"
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/catalog/catalog.hpp>
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/parser/keyword_helper.hpp>
+
+namespace duckdb {
+
+string MaterializeView::Query(ClientContext& context, const FunctionParameters& parameters) {
+    DUCKDB_GRAPHAR_LOG_TRACE("MaterializeView::Query");
+    const auto database_name = StringValue::Get(parameters.values[0]);
+    const auto view_name = StringValue::Get(parameters.values[1]);
+    auto& catalog = Catalog::GetCatalog(context, database_name);
+    if (catalog.GetCatalogType() != "graphar") {
+        throw BinderException("\"%s\" is not an attached GraphAr graph", database_name);
+    }
+    auto& graphar_catalog = catalog.Cast<GraphArCatalog>();
+    const auto& prefix = graphar_catalog.GetGraphInfo()->GetPrefix();
+    if (FileSystem::IsRemoteFile(prefix)) {
+        throw NotImplementedException("Materializing views of a remote GraphAr graph is not supported");
+    }
+    auto view = graphar_catalog.GetMainSchema().GetTables().GetView(view_name);
+    if (!view) {
+        throw BinderException("GraphAr graph \"%s\" has no view \"%s\"", database_name, view_name);
+    }
+
+    const auto fingerprint = GetGraphFingerprint(context, graphar_catalog.GetGraphInfo());
+    const auto name = GraphArTableSet::GetMaterializedName(*view, fingerprint);
+    const auto cache_name = graphar_catalog.GetCacheName();
+    const auto cache_schema = KeywordHelper::WriteOptionallyQuoted(cache_name) + "." + DEFAULT_SCHEMA + ".";
+    string result = "ATTACH IF NOT EXISTS " + KeywordHelper::WriteQuoted(graphar_catalog.GetCachePath()) + " AS " +
+                    KeywordHelper::WriteOptionallyQuoted(cache_name) + ";";
+    // nothing is read when the view is already materialized for the current files
+    result += "CREATE TABLE IF NOT EXISTS " + cache_schema + KeywordHelper::WriteOptionallyQuoted(name) +
+              " AS SELECT * FROM " + KeywordHelper::WriteOptionallyQuoted(database_name) + "." + DEFAULT_SCHEMA + "." +
+              KeywordHelper::WriteOptionallyQuoted(view->name) + ";";
+    // the tables of the view for older files, when the cache is already attached
+    auto cache = Catalog::GetCatalogEntry(context, cache_name);
+    if (cache) {
+        cache->GetSchema(context, DEFAULT_SCHEMA).Scan(context, CatalogType::TABLE_ENTRY, [&](CatalogEntry& entry) {
+            if (entry.name != name && GraphArTableSet::IsMaterializedName(entry.name, view->name)) {
+                result += "DROP TABLE " + cache_schema + KeywordHelper::WriteOptionallyQuoted(entry.name) + ";";
+            }
+        });
+    }
+    return result;
+}
+
+PragmaFunction MaterializeView::GetFunction() {
+    return PragmaFunction::PragmaCall("graphar_materialize", Query, {LogicalType::VARCHAR, LogicalType::VARCHAR});
+}
+
+void MaterializeView::Register(ExtensionLoader& loader) { loader.RegisterFunction(GetFunction()); }
+}  // namespace duckdb
@@ -0,0 +1,121 @@
+#include "functions/table/build_degree_index.hpp"
+
+#include "utils/benchmark.hpp"
+#include "utils/degree_index.hpp"
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/function/table_function.hpp>
+
+#include <graphar/graph_info.h>
+
+namespace duckdb {
+//-------------------------------------------------------------------
+// Bind
+//-------------------------------------------------------------------
+unique_ptr<FunctionData> BuildDegreeIndex::Bind(ClientContext& context, TableFunctionBindInput& input,
+                                                vector<LogicalType>& return_types, vector<string>& names) {
+    bool time_logging = GraphArSettings::is_time_logging(context);
+
+    ScopedTimer t("Bind");
+
+    DUCKDB_GRAPHAR_LOG_TRACE("BuildDegreeIndex::Bind");
+
+    const auto file_path = StringValue::Get(input.inputs[0]);
+    const auto edge_type = StringValue::Get(input.inputs[1]);
+
+    DUCKDB_GRAPHAR_LOG_DEBUG("Load Graph Info");
+
+    auto maybe_graph_info = graphar::GraphInfo::Load(file_path);
+    if (maybe_graph_info.has_error()) {
+        throw IOException("Failed to load graph info from path: %s", file_path);
+    }
+    auto graph_info = maybe_graph_info.value();
+
+    // The edge is found either by its edge type or by its full <src>_<type>_<dst> name
+    std::shared_ptr<graphar::EdgeInfo> edge_info;
+    for (const auto& info : graph_info->GetEdgeInfos()) {
+        if (info->GetEdgeType() != edge_type && GraphArFunctions::GetNameFromInfo(info) != edge_type) {
+            continue;
+        }
+        if (edge_info) {
+            throw BinderException("Edge type '%s' is ambiguous, use <src>_<type>_<dst>", edge_type);
+        }
+        edge_info = info;
+    }
+    if (!edge_info) {
+        throw BinderException("Edges of type '%s' are not found", edge_type);
+    }
+    if (!edge_info->HasAdjacentListType(graphar::AdjListType::ordered_by_source) &&
+        !edge_info->HasAdjacentListType(graphar::AdjListType::ordered_by_dest)) {
+        throw BinderException("Degree index requires an ordered adjacency list");
+    }
+
+    return_types.push_back(LogicalType::VARCHAR);
+    names.push_back("adj_list_type");
+    return_types.push_back(LogicalType::BIGINT);
+    names.push_back("vertices");
+    return_types.push_back(LogicalType::VARCHAR);
+    names.push_back("path");
+
+    DUCKDB_GRAPHAR_LOG_DEBUG("Bind finish");
+    if (time_logging) {
+        t.print();
+    }
+
+    return make_uniq<BuildDegreeIndexBindData>(edge_info, GetDirectory(file_path));
+}
+//-------------------------------------------------------------------
+// State Init
+//-------------------------------------------------------------------
+unique_ptr<GlobalTableFunctionState> BuildDegreeIndexGlobalTableFunctionState::Init(ClientContext& context,
+                                                                                    TableFunctionInitInput& input) {
+    return make_uniq<BuildDegreeIndexGlobalTableFunctionState>();
+}
+//-------------------------------------------------------------------
+// Execute
+//-------------------------------------------------------------------
+void BuildDegreeIndex::Execute(ClientContext& context, TableFunctionInput& input, DataChunk& output) {
+    bool time_logging = GraphArSettings::is_time_logging(context);
+
+    ScopedTimer t("Execute");
+
+    DUCKDB_GRAPHAR_LOG_TRACE("BuildDegreeIndex::Execute");
+
+    auto& gstate = input.global_state->Cast<BuildDegreeIndexGlobalTableFunctionState>();
+    if (gstate.finished) {
+        return;
+    }
+    auto& bind_data = input.bind_data->Cast<BuildDegreeIndexBindData>();
+
+    idx_t row = 0;
+    for (auto adj_list_type : {graphar::AdjListType::ordered_by_source, graphar::AdjListType::ordered_by_dest}) {
+        if (!bind_data.GetEdgeInfo()->HasAdjacentListType(adj_list_type)) {
+            continue;
+        }
+        auto vertices = DegreeIndex::Build(context, bind_data.GetEdgeInfo(), bind_data.GetPrefix(), adj_list_type);
+        output.SetValue(0, row, Value(std::string(AdjListTypeToString(adj_list_type))));
+        output.SetValue(1, row, Value::BIGINT(vertices));
+        output.SetValue(2, row,
+                        Value(DegreeIndex::GetPath(bind_data.GetEdgeInfo(), bind_data.GetPrefix(), adj_list_type)));
+        ++row;
+        if (time_logging) {
+            t.print(std::string(AdjListTypeToString(adj_list_type)));
+        }
+    }
+    output.SetCardinality(row);
+    gstate.finished = true;
+}
+//-------------------------------------------------------------------
+// Register
+//-------------------------------------------------------------------
+TableFunction BuildDegreeIndex::GetFunction() {
+    TableFunction build_degree_index("graphar_build_degree_index", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+                                     Execute, Bind);
+    build_degree_index.init_global = BuildDegreeIndexGlobalTableFunctionState::Init;
+
+    return build_degree_index;
+}
+
+void BuildDegreeIndex::Register(ExtensionLoader& loader) { loader.RegisterFunction(GetFunction()); }
+}  // namespace duckdb
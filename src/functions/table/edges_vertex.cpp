@@ -1,19 +1,126 @@
 #include "functions/table/edges_vertex.hpp"
 
 #include "utils/benchmark.hpp"
+#include "utils/degree_index.hpp"
+#include "utils/edge_delta.hpp"
 #include "utils/func.hpp"
 #include "utils/global_log_manager.hpp"
 
+#include <duckdb/common/file_system.hpp>
 #include <duckdb/common/named_parameter_map.hpp>
+#include <duckdb/common/operator/comparison_operators.hpp>
 #include <duckdb/common/vector_size.hpp>
 #include <duckdb/function/table_function.hpp>
+#include <duckdb/planner/filter/conjunction_filter.hpp>
+#include <duckdb/planner/filter/constant_filter.hpp>
+#include <duckdb/planner/filter/dynamic_filter.hpp>
+#include <duckdb/planner/filter/in_filter.hpp>
+#include <duckdb/planner/filter/optional_filter.hpp>
+#include <duckdb/storage/statistics/node_statistics.hpp>
+#include <duckdb/storage/statistics/numeric_stats.hpp>
 
 #include <graphar/api/high_level_reader.h>
 #include <graphar/status.h>
 
+#include <algorithm>
+#include <list>
+#include <numeric>
+#include <unordered_map>
+
 #include <iostream>
 
 namespace duckdb {
+static std::vector<graphar::AdjListType> GetAdjListTypes(GraphArDirection direction) {
+    switch (direction) {
+        case GraphArDirection::Out:
+            return {graphar::AdjListType::ordered_by_source};
+        case GraphArDirection::In:
+            return {graphar::AdjListType::ordered_by_dest};
+        default:
+            return {graphar::AdjListType::ordered_by_source, graphar::AdjListType::ordered_by_dest};
+    }
+}
+
+// Adds the adjacency lists of every edge type incident to the vertex type, one degree column per edge type or a
+// single summed one
+static void BindVertexType(EdgesVertexBindData& bind_data, const std::string& vertex_type, bool per_edge_type,
+                           vector<string>& names) {
+    const auto& graph_info = bind_data.GetGraphInfo();
+    if (!graph_info->GetVertexInfo(vertex_type)) {
+        throw BinderException("Vertex type '%s' is not found", vertex_type);
+    }
+    idx_t column = 0;
+    for (const auto& edge_info : graph_info->GetEdgeInfos()) {
+        bool found = false;
+        for (auto adj_list_type : GetAdjListTypes(bind_data.GetDirection())) {
+            const auto& side_type = adj_list_type == graphar::AdjListType::ordered_by_source ? edge_info->GetSrcType()
+                                                                                              : edge_info->GetDstType();
+            if (side_type != vertex_type) {
+                continue;
+            }
+            if (!edge_info->HasAdjacentListType(adj_list_type)) {
+                throw BinderException("Edge %s has no %s adjacency list", GraphArFunctions::GetNameFromInfo(edge_info),
+                                      std::string(AdjListTypeToString(adj_list_type)));
+            }
+            bind_data.AddSource(edge_info, adj_list_type, column);
+            found = true;
+        }
+        if (found && per_edge_type) {
+            names.push_back(GraphArFunctions::GetNameFromInfo(edge_info));
+            ++column;
+        }
+    }
+    if (bind_data.GetSources().empty()) {
+        throw BinderException("Vertex type '%s' has no edges", vertex_type);
+    }
+    if (!per_edge_type) {
+        names.push_back("degree");
+        ++column;
+    }
+    bind_data.SetDegreeColumnCount(column);
+}
+// Degree indexes of all sources of the scan, or none when some of them is missing or stale
+static std::vector<unique_ptr<DegreeIndex>> OpenDegreeIndexes(ClientContext& context,
+                                                              const EdgesVertexBindData& bind_data) {
+    std::vector<unique_ptr<DegreeIndex>> result;
+    for (const auto& source : bind_data.GetSources()) {
+        auto index = DegreeIndex::Open(context, source.edge_info, bind_data.GetPrefix(), source.adj_list_type);
+        if (!index) {
+            return {};
+        }
+        result.push_back(std::move(index));
+    }
+    DUCKDB_GRAPHAR_LOG_DEBUG("Using degree index");
+    return result;
+}
+// Degrees of the edges inserted into an attached graph since the last checkpoint, which are not in the offsets yet.
+// Delta edges of vertices appended after the adjacency lists were written are left out like those vertices.
+static std::vector<std::vector<int64_t>> CountDeltaDegrees(ClientContext& context,
+                                                          const EdgesVertexBindData& bind_data) {
+    std::vector<std::vector<int64_t>> result(bind_data.GetDegreeColumnCount());
+    const auto vertex_count = bind_data.GetVertexCount();
+    for (const auto& source : bind_data.GetSources()) {
+        auto delta = EdgeDelta::Read(FileSystem::GetFileSystem(context), bind_data.GetPrefix(), *source.edge_info);
+        if (!delta) {
+            continue;
+        }
+        DUCKDB_GRAPHAR_LOG_DEBUG("Counting " + std::to_string(delta->num_rows()) + " delta edges of " +
+                                 GraphArFunctions::GetNameFromInfo(source.edge_info));
+        auto& degrees = result[source.column];
+        degrees.resize(vertex_count, 0);
+        const int id_column = source.adj_list_type == graphar::AdjListType::ordered_by_source ? 0 : 1;
+        for (const auto& chunk : delta->column(id_column)->chunks()) {
+            const auto ids = std::static_pointer_cast<arrow::Int64Array>(chunk);
+            for (int64_t i = 0; i < ids->length(); ++i) {
+                const auto id = ids->Value(i);
+                if (id >= 0 && id < vertex_count) {
+                    degrees[id]++;
+                }
+            }
+        }
+    }
+    return result;
+}
 //-------------------------------------------------------------------
 // Bind
 //-------------------------------------------------------------------
@@ -26,6 +133,21 @@ unique_ptr<FunctionData> EdgesVertex::Bind(ClientContext& context, TableFunction
     DUCKDB_GRAPHAR_LOG_TRACE("EdgesVertex::Bind");
     DUCKDB_GRAPHAR_LOG_DEBUG("Parse parameters");
     const auto file_path = StringValue::Get(input.inputs[0]);
+    auto direction = GraphArDirection::Out;
+    if (input.named_parameters.count("direction")) {
+        direction = ParseDirection(StringValue::Get(input.named_parameters.at("direction")));
+    }
+    std::string vertex_type;
+    if (input.named_parameters.count("vertex_type")) {
+        vertex_type = StringValue::Get(input.named_parameters.at("vertex_type"));
+    }
+    bool per_edge_type = false;
+    if (input.named_parameters.count("per_edge_type")) {
+        per_edge_type = BooleanValue::Get(input.named_parameters.at("per_edge_type"));
+    }
+    if (per_edge_type && vertex_type.empty()) {
+        throw BinderException("per_edge_type requires vertex_type and a graph yaml");
+    }
 
     DUCKDB_GRAPHAR_LOG_DEBUG("Load Graph Info");
 
@@ -35,22 +157,54 @@ unique_ptr<FunctionData> EdgesVertex::Bind(ClientContext& context, TableFunction
     }
     auto graph_info = maybe_graph_info.value();
 
-    DUCKDB_GRAPHAR_LOG_DEBUG("Load Edge Info");
-
-    auto yaml_content = GetYamlContent(file_path);
-    auto edge_info = graphar::EdgeInfo::Load(yaml_content).value();
-    if (!edge_info) {
-        throw BinderException("No edge of this type");
-    }
-
     DUCKDB_GRAPHAR_LOG_DEBUG("Create BindData");
 
     auto bind_data = make_uniq<EdgesVertexBindData>(file_path);
     bind_data->SetGraphInfo(graph_info);
-    bind_data->SetEdgeInfo(edge_info);
+    bind_data->SetDirection(direction);
+
+    if (!vertex_type.empty()) {
+        DUCKDB_GRAPHAR_LOG_DEBUG("Bind edges of vertex type " + vertex_type);
+        bind_data->SetPrefix(graph_info->GetPrefix());
+        BindVertexType(*bind_data, vertex_type, per_edge_type, names);
+    } else {
+        DUCKDB_GRAPHAR_LOG_DEBUG("Load Edge Info");
+
+        auto yaml_content = GetYamlContent(file_path);
+        auto edge_info = graphar::EdgeInfo::Load(yaml_content).value();
+        if (!edge_info) {
+            throw BinderException("No edge of this type");
+        }
+        for (auto adj_list_type : GetAdjListTypes(direction)) {
+            if (!edge_info->HasAdjacentListType(adj_list_type)) {
+                throw BinderException("Edge has no %s adjacency list",
+                                      std::string(AdjListTypeToString(adj_list_type)));
+            }
+            bind_data->AddSource(edge_info, adj_list_type, 0);
+        }
+        // Both degrees are summed per vertex, so the two sides have to share the vertex ids and the chunking
+        if (direction == GraphArDirection::Both && (edge_info->GetSrcType() != edge_info->GetDstType() ||
+                                                    edge_info->GetSrcChunkSize() != edge_info->GetDstChunkSize())) {
+            throw BinderException("Direction 'both' requires the same source and destination vertex type");
+        }
+        bind_data->SetPrefix(GetDirectory(file_path));
+        names.push_back("degree");
+    }
+    // Offset chunks of all sources are read together, so they have to cover the same vertices
+    for (const auto& source : bind_data->GetSources()) {
+        if (GetAdjListVertexChunkSize(source.edge_info, source.adj_list_type) != bind_data->GetVertexChunkSize()) {
+            throw BinderException("Edges of vertex type '%s' have different vertex chunk sizes", vertex_type);
+        }
+    }
+
+    // read once here for the statistics, the cardinality and every scan of the bound function
+    const auto& first_source = bind_data->GetSources()[0];
+    bind_data->SetVertexCount(
+        GetVertexCount(first_source.edge_info, bind_data->GetPrefix(), first_source.adj_list_type));
+    bind_data->SetDegreeIndexes(OpenDegreeIndexes(context, *bind_data));
+    bind_data->SetDeltaDegrees(CountDeltaDegrees(context, *bind_data));
 
-    return_types.push_back(LogicalType::BIGINT);
-    names.push_back("degree");
+    return_types.assign(bind_data->GetDegreeColumnCount(), LogicalType::BIGINT);
     return_types.push_back(LogicalTypeId::BIGINT);
     names.push_back(GID_COLUMN);
 
@@ -62,6 +216,324 @@ unique_ptr<FunctionData> EdgesVertex::Bind(ClientContext& context, TableFunction
     return bind_data;
 }
 //-------------------------------------------------------------------
+// Filters
+//-------------------------------------------------------------------
+static bool IsSupportedFilter(const TableFilter& filter) {
+    switch (filter.filter_type) {
+        case TableFilterType::CONSTANT_COMPARISON:
+        case TableFilterType::IN_FILTER:
+        case TableFilterType::IS_NULL:
+        case TableFilterType::IS_NOT_NULL:
+        case TableFilterType::OPTIONAL_FILTER:
+        case TableFilterType::DYNAMIC_FILTER:
+            return true;
+        case TableFilterType::CONJUNCTION_AND:
+        case TableFilterType::CONJUNCTION_OR: {
+            auto& children = filter.filter_type == TableFilterType::CONJUNCTION_AND
+                                 ? filter.Cast<ConjunctionAndFilter>().child_filters
+                                 : filter.Cast<ConjunctionOrFilter>().child_filters;
+            for (auto& child : children) {
+                if (!IsSupportedFilter(*child)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// Narrows [min_value, max_value] to the values that can pass the filter
+static void NarrowRange(const TableFilter& filter, int64_t& min_value, int64_t& max_value) {
+    switch (filter.filter_type) {
+        case TableFilterType::CONSTANT_COMPARISON: {
+            auto& constant_filter = filter.Cast<ConstantFilter>();
+            const auto constant = constant_filter.constant.GetValue<int64_t>();
+            switch (constant_filter.comparison_type) {
+                case ExpressionType::COMPARE_EQUAL:
+                    min_value = std::max(min_value, constant);
+                    max_value = std::min(max_value, constant);
+                    break;
+                case ExpressionType::COMPARE_GREATERTHAN:
+                    // saturated, so that a constant at the limit of BIGINT does not overflow
+                    if (constant < NumericLimits<int64_t>::Maximum()) {
+                        min_value = std::max(min_value, constant + 1);
+                    } else {
+                        min_value = NumericLimits<int64_t>::Maximum();
+                    }
+                    break;
+                case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+                    min_value = std::max(min_value, constant);
+                    break;
+                case ExpressionType::COMPARE_LESSTHAN:
+                    if (constant > NumericLimits<int64_t>::Minimum()) {
+                        max_value = std::min(max_value, constant - 1);
+                    } else {
+                        max_value = NumericLimits<int64_t>::Minimum();
+                    }
+                    break;
+                case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+                    max_value = std::min(max_value, constant);
+                    break;
+                default:
+                    break;
+            }
+            break;
+        }
+        case TableFilterType::IN_FILTER: {
+            int64_t in_min = NumericLimits<int64_t>::Maximum(), in_max = NumericLimits<int64_t>::Minimum();
+            for (auto& value : filter.Cast<InFilter>().values) {
+                in_min = std::min(in_min, value.GetValue<int64_t>());
+                in_max = std::max(in_max, value.GetValue<int64_t>());
+            }
+            min_value = std::max(min_value, in_min);
+            max_value = std::min(max_value, in_max);
+            break;
+        }
+        case TableFilterType::CONJUNCTION_AND:
+            for (auto& child : filter.Cast<ConjunctionAndFilter>().child_filters) {
+                NarrowRange(*child, min_value, max_value);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// Whether some value in [min_value, max_value] can pass the filter
+static bool CanQualify(const TableFilter& filter, int64_t min_value, int64_t max_value) {
+    auto stats = NumericStats::CreateEmpty(LogicalType::BIGINT);
+    NumericStats::SetMin(stats, Value::BIGINT(min_value));
+    NumericStats::SetMax(stats, Value::BIGINT(max_value));
+    stats.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+    return filter.CheckStatistics(stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+template <class OP>
+static idx_t SelectRows(const int64_t* values, const int64_t constant, SelectionVector& sel, const idx_t count) {
+    idx_t result = 0;
+    for (idx_t i = 0; i < count; ++i) {
+        const auto row = sel.get_index(i);
+        if (OP::Operation(values[row], constant)) {
+            sel.set_index(result++, row);
+        }
+    }
+    return result;
+}
+
+// Keeps the rows of sel whose values pass the filter; returns how many are kept
+static idx_t SelectRows(const TableFilter& filter, const int64_t* values, SelectionVector& sel, const idx_t count) {
+    switch (filter.filter_type) {
+        case TableFilterType::CONSTANT_COMPARISON: {
+            auto& constant_filter = filter.Cast<ConstantFilter>();
+            const auto constant = constant_filter.constant.GetValue<int64_t>();
+            switch (constant_filter.comparison_type) {
+                case ExpressionType::COMPARE_EQUAL:
+                    return SelectRows<Equals>(values, constant, sel, count);
+                case ExpressionType::COMPARE_NOTEQUAL:
+                    return SelectRows<NotEquals>(values, constant, sel, count);
+                case ExpressionType::COMPARE_GREATERTHAN:
+                    return SelectRows<GreaterThan>(values, constant, sel, count);
+                case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+                    return SelectRows<GreaterThanEquals>(values, constant, sel, count);
+                case ExpressionType::COMPARE_LESSTHAN:
+                    return SelectRows<LessThan>(values, constant, sel, count);
+                case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+                    return SelectRows<LessThanEquals>(values, constant, sel, count);
+                default:
+                    throw NotImplementedException("Unsupported comparison on edges_vertex: " +
+                                                  filter.ToString("column"));
+            }
+        }
+        case TableFilterType::IN_FILTER: {
+            std::vector<int64_t> in_values;
+            for (auto& value : filter.Cast<InFilter>().values) {
+                in_values.push_back(value.GetValue<int64_t>());
+            }
+            std::sort(in_values.begin(), in_values.end());
+            idx_t result = 0;
+            for (idx_t i = 0; i < count; ++i) {
+                const auto row = sel.get_index(i);
+                if (std::binary_search(in_values.begin(), in_values.end(), values[row])) {
+                    sel.set_index(result++, row);
+                }
+            }
+            return result;
+        }
+        case TableFilterType::IS_NULL:
+            return 0;
+        case TableFilterType::IS_NOT_NULL:
+            return count;
+        case TableFilterType::CONJUNCTION_AND: {
+            idx_t result = count;
+            for (auto& child : filter.Cast<ConjunctionAndFilter>().child_filters) {
+                result = SelectRows(*child, values, sel, result);
+            }
+            return result;
+        }
+        case TableFilterType::CONJUNCTION_OR: {
+            std::vector<bool> keep(STANDARD_VECTOR_SIZE, false);
+            for (auto& child : filter.Cast<ConjunctionOrFilter>().child_filters) {
+                SelectionVector child_sel(STANDARD_VECTOR_SIZE);
+                for (idx_t i = 0; i < count; ++i) {
+                    child_sel.set_index(i, sel.get_index(i));
+                }
+                const auto child_count = SelectRows(*child, values, child_sel, count);
+                for (idx_t i = 0; i < child_count; ++i) {
+                    keep[child_sel.get_index(i)] = true;
+                }
+            }
+            idx_t result = 0;
+            for (idx_t i = 0; i < count; ++i) {
+                const auto row = sel.get_index(i);
+                if (keep[row]) {
+                    sel.set_index(result++, row);
+                }
+            }
+            return result;
+        }
+        case TableFilterType::OPTIONAL_FILTER: {
+            // The filter is also kept above the scan, applying it here only saves work
+            auto& child = filter.Cast<OptionalFilter>().child_filter;
+            return child && IsSupportedFilter(*child) ? SelectRows(*child, values, sel, count) : count;
+        }
+        case TableFilterType::DYNAMIC_FILTER: {
+            // Top-k threshold, tightened while the query runs
+            auto& filter_data = filter.Cast<DynamicFilter>().filter_data;
+            if (!filter_data) {
+                return count;
+            }
+            lock_guard<mutex> guard(filter_data->lock);
+            if (!filter_data->initialized) {
+                return count;
+            }
+            return SelectRows(*filter_data->filter, values, sel, count);
+        }
+        default:
+            throw NotImplementedException("Unsupported filter on edges_vertex: " + filter.ToString("column"));
+    }
+}
+//-------------------------------------------------------------------
+// Degree summaries
+//-------------------------------------------------------------------
+// Degree summaries of the offset chunks read by earlier scans, valid while the count files of their adjacency lists
+// are unchanged. The least recently used summaries are dropped beyond the capacity, so that scans over many graphs
+// do not grow the cache without bound.
+class DegreeSummaryCache {
+public:
+    static constexpr idx_t CAPACITY = 65536;
+
+    static DegreeSummaryCache& Get() {
+        static DegreeSummaryCache cache;
+        return cache;
+    }
+
+    bool Lookup(const std::string& key, const std::vector<FileStamp>& stamps, DegreeSummary& summary) {
+        lock_guard<mutex> guard(lock);
+        auto it = entries.find(key);
+        if (it == entries.end() || it->second->stamps != stamps) {
+            return false;
+        }
+        usage.splice(usage.begin(), usage, it->second);
+        summary = it->second->summary;
+        return true;
+    }
+
+    void Store(const std::string& key, const std::vector<FileStamp>& stamps, const DegreeSummary& summary) {
+        lock_guard<mutex> guard(lock);
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            usage.erase(it->second);
+            entries.erase(it);
+        }
+        usage.push_front({key, stamps, summary});
+        entries[key] = usage.begin();
+        if (usage.size() > CAPACITY) {
+            entries.erase(usage.back().key);
+            usage.pop_back();
+        }
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        std::vector<FileStamp> stamps;
+        DegreeSummary summary;
+    };
+
+    mutex lock;
+    // most recently used first
+    std::list<Entry> usage;
+    std::unordered_map<std::string, std::list<Entry>::iterator> entries;
+};
+
+// Stamps of the vertex count and delta count files of the sources of every degree column. Every write of offsets in
+// this extension (COPY, CHECKPOINT) rewrites the former and every edge insert the latter, so they validate the cached
+// summaries with a few stats per scan. A missing delta count gives an empty stamp.
+static std::vector<std::vector<FileStamp>> GetSummaryStamps(ClientContext& context,
+                                                            const EdgesVertexBindData& bind_data) {
+    auto& fs = FileSystem::GetFileSystem(context);
+    std::vector<std::vector<FileStamp>> stamps(bind_data.GetDegreeColumnCount());
+    for (const auto& source : bind_data.GetSources()) {
+        GAR_ASSIGN_OR_RAISE_ERROR(auto count_path, source.edge_info->GetVerticesNumFilePath(source.adj_list_type));
+        stamps[source.column].push_back(GetFileStamp(context, bind_data.GetPrefix() + count_path));
+        const auto delta_path = bind_data.GetPrefix() + EdgeDelta::GetCountPath(*source.edge_info);
+        stamps[source.column].push_back(fs.FileExists(delta_path) ? GetFileStamp(context, delta_path) : FileStamp());
+    }
+    return stamps;
+}
+
+// Bounds of the degrees of a degree column over the first count vertices of the loaded offset chunks, which start at
+// vertex chunk_begin, with the degrees of the delta edges of the column
+static DegreeSummary SummarizeDegrees(const std::vector<DegreeSource>& sources,
+                                      const std::vector<std::shared_ptr<arrow::Int64Array>>& offsets,
+                                      const std::vector<int64_t>& delta_degrees, idx_t column, idx_t chunk_begin,
+                                      idx_t count) {
+    DegreeSummary summary;
+    if (count == 0) {
+        return summary;
+    }
+    summary.min = NumericLimits<int64_t>::Maximum();
+    summary.max = NumericLimits<int64_t>::Minimum();
+    for (idx_t i = 0; i < count; ++i) {
+        int64_t degree = 0;
+        for (idx_t k = 0; k < sources.size(); ++k) {
+            if (sources[k].column == column) {
+                degree += offsets[k]->Value(i + 1) - offsets[k]->Value(i);
+            }
+        }
+        if (chunk_begin + i < delta_degrees.size()) {
+            degree += delta_degrees[chunk_begin + i];
+            summary.sum += delta_degrees[chunk_begin + i];
+        }
+        summary.min = std::min(summary.min, degree);
+        summary.max = std::max(summary.max, degree);
+    }
+    for (idx_t k = 0; k < sources.size(); ++k) {
+        if (sources[k].column == column) {
+            summary.sum += offsets[k]->Value(count) - offsets[k]->Value(0);
+        }
+    }
+    return summary;
+}
+// Bounds of the summed degrees of a degree column in a vertex chunk over all indexes
+static DegreeSummary CombineSummaries(const std::vector<DegreeSource>& sources,
+                                      const std::vector<unique_ptr<DegreeIndex>>& indexes, idx_t column,
+                                      idx_t chunk_index) {
+    DegreeSummary result;
+    for (idx_t k = 0; k < sources.size(); ++k) {
+        if (sources[k].column != column) {
+            continue;
+        }
+        const auto& summary = indexes[k]->GetSummaries()[chunk_index];
+        result.min += summary.min;
+        result.max += summary.max;
+        result.sum += summary.sum;
+    }
+    return result;
+}
+//-------------------------------------------------------------------
 // State Init
 //-------------------------------------------------------------------
 unique_ptr<GlobalTableFunctionState> EdgesVertexGlobalTableFunctionState::Init(ClientContext& context,
@@ -73,47 +545,43 @@ unique_ptr<GlobalTableFunctionState> EdgesVertexGlobalTableFunctionState::Init(C
     DUCKDB_GRAPHAR_LOG_TRACE("EdgesVertexGlobalTableFunctionState::Init");
     DUCKDB_GRAPHAR_LOG_DEBUG("Cast BindData");
 
-    auto bind_data = input.bind_data->Cast<EdgesVertexBindData>();
+    auto& bind_data = input.bind_data->Cast<EdgesVertexBindData>();
 
     if (time_logging) {
         t.print("cast");
     }
 
-    auto prefix = GetDirectory(bind_data.GetFilePath());
-    auto vertex_count = GetVertexCount(bind_data.GetEdgeInfo(), prefix);
+    const auto vertex_count = bind_data.GetVertexCount();
     idx_t iter = 0, end_iter = vertex_count;
 
     if (time_logging) {
         t.print("edges");
     }
 
+    std::vector<optional_ptr<const TableFilter>> degree_filters(bind_data.GetDegreeColumnCount());
+    optional_ptr<const TableFilter> gid_filter;
     if (input.filters) {
         DUCKDB_GRAPHAR_LOG_DEBUG("Found filters");
 
-        if (input.filters->filters.size() > 1) {
-            throw NotImplementedException("Multiple filters are not supported");
-        }
-        auto filter_id = input.filters->filters.begin()->first;
-        auto filter_index = input.column_ids[filter_id];
-        auto& filter = input.filters->filters.begin()->second;
-        if (filter->filter_type != TableFilterType::CONSTANT_COMPARISON) {
-            throw NotImplementedException("Only constant filters are supported, but got " + filter->ToString(" "));
-        }
-        auto filter_expr = filter->ToString(" ");
-        if (filter_expr[1] != '=') {
-            throw NotImplementedException("Only equality filters are supported");
-        }
-
-        auto filter_value = filter_expr.substr(2);
-
-        if (filter_index + 1 == input.column_ids.size()) {
-            DUCKDB_GRAPHAR_LOG_DEBUG("Filter by gid");
-            int vid = std::stoi(filter_value);
-
-            iter = vid;
-            end_iter = vid + 1;
-        } else {
-            throw NotImplementedException("Filter by property is not supported");
+        for (auto& entry : input.filters->filters) {
+            auto column_index = input.column_ids[entry.first];
+            auto& filter = *entry.second;
+            if (!IsSupportedFilter(filter)) {
+                throw NotImplementedException("Unsupported filter on edges_vertex: " + filter.ToString("column"));
+            }
+            if (column_index < degree_filters.size()) {
+                DUCKDB_GRAPHAR_LOG_DEBUG("Filter by degree");
+                degree_filters[column_index] = &filter;
+            } else {
+                DUCKDB_GRAPHAR_LOG_DEBUG("Filter by gid");
+                gid_filter = &filter;
+                int64_t min_vid = 0, max_vid = vertex_count - 1;
+                NarrowRange(filter, min_vid, max_vid);
+                min_vid = std::min<int64_t>(std::max<int64_t>(min_vid, 0), vertex_count);
+                max_vid = std::min<int64_t>(max_vid, vertex_count - 1);
+                iter = min_vid;
+                end_iter = std::max(min_vid, max_vid + 1);
+            }
         }
     }
 
@@ -122,120 +590,289 @@ unique_ptr<GlobalTableFunctionState> EdgesVertexGlobalTableFunctionState::Init(C
         t.print();
     }
 
-    return make_uniq<EdgesVertexGlobalTableFunctionState>(context, bind_data, bind_data.GetEdgeInfo(), prefix, iter,
-                                                          end_iter);
+    auto result = make_uniq<EdgesVertexGlobalTableFunctionState>(context, bind_data, iter, end_iter);
+    for (idx_t column = 0; column < degree_filters.size(); ++column) {
+        result->GetState().SetDegreeFilter(column, degree_filters[column]);
+    }
+    result->GetState().SetGidFilter(gid_filter);
+    if (result->GetState().HasDegreeFilter() && bind_data.GetDegreeIndexes().empty()) {
+        result->GetState().SetSummaryStamps(GetSummaryStamps(context, bind_data));
+    }
+    return std::move(result);
+}
+unique_ptr<LocalTableFunctionState> EdgesVertexLocalTableFunctionState::Init(ExecutionContext& context,
+                                                                             TableFunctionInitInput& input,
+                                                                             GlobalTableFunctionState* global_state) {
+    DUCKDB_GRAPHAR_LOG_TRACE("EdgesVertexLocalTableFunctionState::Init");
+    return make_uniq<EdgesVertexLocalTableFunctionState>();
 }
 //-------------------------------------------------------------------
-// GetAdjListOffsetOfVertices
+// Execute
 //-------------------------------------------------------------------
-graphar::Result<vector<std::pair<graphar::IdType, graphar::IdType>>> EdgesVertex::GetAdjListOffsetOfVertices(
-    ClientContext& context, const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& prefix,
-    graphar::AdjListType adj_list_type, idx_t start, idx_t end) {
-    ScopedTimer t("GetAdjListOffsetOfVertices");
+// Plain loops without aliasing, so that the compiler vectorizes them
+static inline void SetDegrees(const int64_t* __restrict offsets, int64_t* __restrict degrees, idx_t count) {
+    for (idx_t i = 0; i < count; ++i) {
+        degrees[i] = offsets[i + 1] - offsets[i];
+    }
+}
 
-    if (start >= end) {
-        return vector<std::pair<graphar::IdType, graphar::IdType>>(0);
+static inline void AddDegrees(const int64_t* __restrict offsets, int64_t* __restrict degrees, idx_t count) {
+    for (idx_t i = 0; i < count; ++i) {
+        degrees[i] += offsets[i + 1] - offsets[i];
     }
-    graphar::IdType vertex_chunk_size;
-    if (adj_list_type == graphar::AdjListType::ordered_by_source) {
-        vertex_chunk_size = edge_info->GetSrcChunkSize();
-    } else if (adj_list_type == graphar::AdjListType::ordered_by_dest) {
-        vertex_chunk_size = edge_info->GetDstChunkSize();
-    } else {
-        return graphar::Status::Invalid(
-            "The adj list type has to be ordered_by_source or ordered_by_dest, but "
-            "got ",
-            std::string(AdjListTypeToString(adj_list_type)));
-    }
-
-    graphar::IdType offset_chunk_index = start / vertex_chunk_size;
-    graphar::IdType offset_in_file = start % vertex_chunk_size;
-    GAR_ASSIGN_OR_RAISE(auto offset_file_path, edge_info->GetAdjListOffsetFilePath(offset_chunk_index, adj_list_type));
-    std::string out_prefix;
-    GAR_ASSIGN_OR_RAISE(auto fs, graphar::FileSystemFromUriOrPath(prefix, &out_prefix));
-    auto adjacent_list = edge_info->GetAdjacentList(adj_list_type);
-    if (adjacent_list == nullptr) {
-        return graphar::Status::Invalid("The adjacent list is not set for adj list type ",
-                                        std::string(AdjListTypeToString(adj_list_type)));
-    }
-    auto file_type = adjacent_list->GetFileType();
-    std::string path = out_prefix + offset_file_path;
-    DUCKDB_GRAPHAR_LOG_DEBUG("Opening table");
-    GAR_ASSIGN_OR_RAISE(auto table, fs->ReadFileToTable(path, file_type));
-    idx_t len = end - start;
-    auto result = vector<std::pair<graphar::IdType, graphar::IdType>>(len);
-    auto slice = table->column(0)->Slice(offset_in_file, len + 1);
-    auto chunks_num = slice->num_chunks();
-    auto chunk_size = slice->chunk(0)->length();
-
-    vector<std::shared_ptr<arrow::NumericArray<arrow::Int64Type>>> arrays(chunks_num);
-    for (idx_t i = 0; i < chunks_num; ++i) {
-        arrays[i] = std::static_pointer_cast<arrow::NumericArray<arrow::Int64Type>>(slice->chunk(i));
-    }
-
-    for (idx_t i = 0; i < chunks_num; ++i) {
-        const auto values = arrays[i]->raw_values();
-        int64_t arr_len = arrays[i]->length();
-        int64_t current = values[0], nxt{};
-        for (idx_t j = 0; j < arr_len; ++j) {
-            if (j < arr_len - 1) {
-                nxt = values[j + 1];
-            } else if (i < chunks_num - 1) {
-                nxt = arrays[i + 1]->raw_values()[0];
-            } else {
-                break;
-            }
-            result[i * chunk_size + j] = std::make_pair(current, nxt);
-            current = nxt;
-        }
+}
+
+static inline void AddDeltaDegrees(const int64_t* __restrict delta_degrees, int64_t* __restrict degrees, idx_t count) {
+    for (idx_t i = 0; i < count; ++i) {
+        degrees[i] += delta_degrees[i];
     }
-    return result;
 }
-//-------------------------------------------------------------------
-// Execute
-//-------------------------------------------------------------------
+
 inline void EdgesVertex::Execute(ClientContext& context, TableFunctionInput& input, DataChunk& output) {
     bool time_logging = GraphArSettings::is_time_logging(context);
 
     ScopedTimer t("Execute");
 
     DUCKDB_GRAPHAR_LOG_TRACE("EdgesVertex::Execute");
-    DUCKDB_GRAPHAR_LOG_DEBUG("Cast Global state");
+    DUCKDB_GRAPHAR_LOG_DEBUG("Cast states");
 
     EdgesVertexGlobalState& gstate = input.global_state->Cast<EdgesVertexGlobalTableFunctionState>().GetState();
+    auto& lstate = input.local_state->Cast<EdgesVertexLocalTableFunctionState>();
+
+    const auto& sources = gstate.GetSources();
+    const idx_t column_count = gstate.GetDegreeColumnCount();
+    const bool has_degree_filter = gstate.HasDegreeFilter();
+    const auto gid_filter = gstate.GetGidFilter();
+    while (true) {
+        while (lstate.iter >= lstate.end_iter) {
+            idx_t chunk_index;
+            if (!gstate.NextChunk(chunk_index)) {
+                DUCKDB_GRAPHAR_LOG_DEBUG("All offset chunks are taken");
+                output.SetCardinality(0);
+                return;
+            }
+            const idx_t chunk_begin = chunk_index * gstate.GetVertexChunkSize();
+            const idx_t chunk_end = std::min(chunk_begin + gstate.GetVertexChunkSize(), gstate.GetEndIter());
+            if (gid_filter && !CanQualify(*gid_filter, chunk_begin, chunk_end - 1)) {
+                continue;
+            }
+            // Chunks whose degrees cannot pass the filters (e.g. the top-k threshold) are skipped unread
+            const auto& indexes = gstate.GetDegreeIndexes();
+            std::vector<std::string> summary_keys(column_count);
+            bool skip = false;
+            for (idx_t column = 0; column < column_count && !skip; ++column) {
+                const auto degree_filter = gstate.GetDegreeFilter(column);
+                if (!degree_filter) {
+                    continue;
+                }
+                DegreeSummary summary;
+                if (indexes.empty()) {
+                    for (const auto& source : sources) {
+                        if (source.column != column) {
+                            continue;
+                        }
+                        const auto& prefix = gstate.GetPrefix();
+                        summary_keys[column] +=
+                            GetOffsetChunkPath(source.edge_info, prefix, source.adj_list_type, chunk_index) + ";";
+                    }
+                    if (!DegreeSummaryCache::Get().Lookup(summary_keys[column], gstate.GetSummaryStamps(column),
+                                                          summary)) {
+                        continue;
+                    }
+                } else {
+                    summary = CombineSummaries(sources, indexes, column, chunk_index);
+                }
+                skip = !CanQualify(*degree_filter, summary.min, summary.max);
+            }
+            if (skip) {
+                DUCKDB_GRAPHAR_LOG_DEBUG("Skipping offset chunk " + std::to_string(chunk_index));
+                continue;
+            }
 
-    DUCKDB_GRAPHAR_LOG_DEBUG("Chunk " + std::to_string(gstate.GetChunkCount()) + ": Begin iteration");
-    idx_t start = gstate.GetIter();
-    idx_t end = gstate.GetIter() + STANDARD_VECTOR_SIZE;
-    if (end > gstate.GetEndIter()) {
-        end = gstate.GetEndIter();
-    }
-    DUCKDB_GRAPHAR_LOG_DEBUG("start: " + std::to_string(start) + " end: " + std::to_string(end));
-    DUCKDB_GRAPHAR_LOG_DEBUG("Calling GetAdjListOffsetOfVertices");
-    vector<std::pair<graphar::IdType, graphar::IdType>> result =
-        GetAdjListOffsetOfVertices(context, gstate.GetEdgeInfo(), gstate.GetPrefix(),
-                                   graphar::AdjListType::ordered_by_source, start, end)
-            .value();
-    DUCKDB_GRAPHAR_LOG_DEBUG("Filling output");
-    for (; gstate.GetIter() < end; gstate.IncrementIter()) {
-        auto i = gstate.GetIter() - start;
-        output.SetValue(0, i, result[i].second - result[i].first);
-        output.SetValue(1, i, static_cast<int64_t>(gstate.GetIter()));
-    }
-    if (end <= start) {
-        output.SetCapacity(0);
-        output.SetCardinality(0);
-    } else {
-        output.SetCapacity(end - start);
-        output.SetCardinality(end - start);
-    }
+            lstate.chunk_index = chunk_index;
+            lstate.iter = std::max(chunk_begin, gstate.GetIter());
+            lstate.end_iter = gstate.GetEndIter();
+            lstate.from_index = !indexes.empty();
+            if (lstate.from_index) {
+                DUCKDB_GRAPHAR_LOG_DEBUG("Reading degree index chunk " + std::to_string(chunk_index));
+                const idx_t chunk_vertices = std::min(gstate.GetVertexChunkSize(),
+                                                      indexes[0]->GetVertexCount() - chunk_begin);
+                lstate.end_iter = std::min(chunk_begin + chunk_vertices, lstate.end_iter);
+                // Only the scanned part of the chunk is read, at its position in the chunk
+                const idx_t count = lstate.end_iter - lstate.iter;
+                lstate.degrees.resize(column_count);
+                std::vector<bool> filled(column_count, false);
+                std::vector<int64_t> other;
+                for (idx_t k = 0; k < sources.size(); ++k) {
+                    auto& column_degrees = lstate.degrees[sources[k].column];
+                    column_degrees.resize(chunk_vertices);
+                    auto degrees = column_degrees.data() + (lstate.iter - chunk_begin);
+                    if (!filled[sources[k].column]) {
+                        indexes[k]->Read(lstate.iter, count, degrees);
+                        filled[sources[k].column] = true;
+                        continue;
+                    }
+                    other.resize(count);
+                    indexes[k]->Read(lstate.iter, count, other.data());
+                    for (idx_t i = 0; i < count; ++i) {
+                        degrees[i] += other[i];
+                    }
+                }
+            } else {
+                DUCKDB_GRAPHAR_LOG_DEBUG("Loading offset chunk " + std::to_string(chunk_index));
+                lstate.offsets.clear();
+                for (const auto& source : sources) {
+                    lstate.offsets.push_back(
+                        ReadOffsetChunk(source.edge_info, gstate.GetPrefix(), source.adj_list_type, chunk_index));
+                }
+                idx_t chunk_vertices = NumericLimits<idx_t>::Maximum();
+                for (const auto& offsets : lstate.offsets) {
+                    chunk_vertices = std::min<idx_t>(offsets->length() - 1, chunk_vertices);
+                }
+                lstate.end_iter = std::min(chunk_begin + chunk_vertices, lstate.end_iter);
+                for (idx_t column = 0; column < column_count; ++column) {
+                    const auto degree_filter = gstate.GetDegreeFilter(column);
+                    if (!degree_filter) {
+                        continue;
+                    }
+                    auto summary = SummarizeDegrees(sources, lstate.offsets, gstate.GetDeltaDegrees()[column], column,
+                                                    chunk_begin, chunk_vertices);
+                    DegreeSummaryCache::Get().Store(summary_keys[column], gstate.GetSummaryStamps(column), summary);
+                    if (!CanQualify(*degree_filter, summary.min, summary.max)) {
+                        lstate.iter = lstate.end_iter;
+                    }
+                }
+            }
+            if (time_logging) {
+                t.print("offsets");
+            }
+        }
 
-    DUCKDB_GRAPHAR_LOG_DEBUG("Chunk " + std::to_string(gstate.GetChunkCount()) + ": Finish iteration");
+        const idx_t start = lstate.iter;
+        const idx_t end = std::min<idx_t>(start + STANDARD_VECTOR_SIZE, lstate.end_iter);
+        const idx_t count = end - start;
+        lstate.iter = end;
+        DUCKDB_GRAPHAR_LOG_DEBUG("start: " + std::to_string(start) + " end: " + std::to_string(end));
+        if (gid_filter && !CanQualify(*gid_filter, start, end - 1)) {
+            continue;
+        }
+        const idx_t chunk_offset = start - lstate.chunk_index * gstate.GetVertexChunkSize();
+        if (lstate.from_index) {
+            for (idx_t column = 0; column < column_count; ++column) {
+                std::copy_n(lstate.degrees[column].data() + chunk_offset, count,
+                            FlatVector::GetData<int64_t>(output.data[column]));
+            }
+        } else {
+            std::vector<bool> filled(column_count, false);
+            for (idx_t k = 0; k < sources.size(); ++k) {
+                const int64_t* offsets = lstate.offsets[k]->raw_values() + chunk_offset;
+                auto degrees = FlatVector::GetData<int64_t>(output.data[sources[k].column]);
+                if (!filled[sources[k].column]) {
+                    SetDegrees(offsets, degrees, count);
+                    filled[sources[k].column] = true;
+                } else {
+                    AddDegrees(offsets, degrees, count);
+                }
+            }
+        }
+        // the edges inserted since the last checkpoint are not in the offsets yet
+        for (idx_t column = 0; column < column_count; ++column) {
+            const auto& delta_degrees = gstate.GetDeltaDegrees()[column];
+            if (!delta_degrees.empty()) {
+                AddDeltaDegrees(delta_degrees.data() + start, FlatVector::GetData<int64_t>(output.data[column]), count);
+            }
+        }
+        if (!has_degree_filter && !gid_filter) {
+            output.data[column_count].Sequence(static_cast<int64_t>(start), 1, count);
+            output.SetCardinality(count);
+            break;
+        }
+
+        auto gids = FlatVector::GetData<int64_t>(output.data[column_count]);
+        std::iota(gids, gids + count, static_cast<int64_t>(start));
+        SelectionVector sel(STANDARD_VECTOR_SIZE);
+        for (idx_t i = 0; i < count; ++i) {
+            sel.set_index(i, i);
+        }
+        idx_t selected = count;
+        if (gid_filter) {
+            selected = SelectRows(*gid_filter, gids, sel, selected);
+        }
+        for (idx_t column = 0; column < column_count; ++column) {
+            if (gstate.GetDegreeFilter(column)) {
+                selected = SelectRows(*gstate.GetDegreeFilter(column),
+                                      FlatVector::GetData<int64_t>(output.data[column]), sel, selected);
+            }
+        }
+        if (selected == 0) {
+            continue;
+        }
+        // Compact the selected rows in place, they are in increasing order
+        for (idx_t column = 0; column <= column_count; ++column) {
+            auto values = FlatVector::GetData<int64_t>(output.data[column]);
+            for (idx_t i = 0; i < selected; ++i) {
+                values[i] = values[sel.get_index(i)];
+            }
+        }
+        output.SetCardinality(selected);
+        break;
+    }
 
     if (time_logging) {
         t.print();
     }
-    gstate.IncrementChunkCount();
+}
+//-------------------------------------------------------------------
+// GetStatistics
+//-------------------------------------------------------------------
+unique_ptr<BaseStatistics> EdgesVertex::GetStatistics(ClientContext& context, const FunctionData* bind_data,
+                                                      column_t column_index) {
+    DUCKDB_GRAPHAR_LOG_TRACE("EdgesVertex::GetStatistics");
+    auto& edges_vertex_bind_data = bind_data->Cast<EdgesVertexBindData>();
+    const auto& sources = edges_vertex_bind_data.GetSources();
+    const idx_t column_count = edges_vertex_bind_data.GetDegreeColumnCount();
+    auto stats = NumericStats::CreateUnknown(LogicalType::BIGINT);
+    stats.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+    if (column_index == column_count) {
+        NumericStats::SetMin(stats, Value::BIGINT(0));
+        NumericStats::SetMax(stats, Value::BIGINT(edges_vertex_bind_data.GetVertexCount() - 1));
+    } else if (column_index < column_count) {
+        NumericStats::SetMin(stats, Value::BIGINT(0));
+        const auto& indexes = edges_vertex_bind_data.GetDegreeIndexes();
+        if (!indexes.empty()) {
+            int64_t min_degree = 0, max_degree = 0;
+            for (idx_t k = 0; k < sources.size(); ++k) {
+                if (sources[k].column != column_index) {
+                    continue;
+                }
+                const auto summary = indexes[k]->GetSummary();
+                min_degree += summary.min;
+                max_degree += summary.max;
+            }
+            NumericStats::SetMin(stats, Value::BIGINT(min_degree));
+            NumericStats::SetMax(stats, Value::BIGINT(max_degree));
+        }
+    } else {
+        return nullptr;
+    }
+    return stats.ToUnique();
+}
+//-------------------------------------------------------------------
+// GetCardinality
+//-------------------------------------------------------------------
+unique_ptr<NodeStatistics> EdgesVertex::GetCardinality(ClientContext& context, const FunctionData* bind_data) {
+    const auto vertex_count = bind_data->Cast<EdgesVertexBindData>().GetVertexCount();
+    return make_uniq<NodeStatistics>(vertex_count, vertex_count);
+}
+//-------------------------------------------------------------------
+// GetPartitionData
+//-------------------------------------------------------------------
+OperatorPartitionData EdgesVertex::GetPartitionData(ClientContext& context, TableFunctionGetPartitionInput& input) {
+    if (input.partition_info.RequiresPartitionColumns()) {
+        throw InternalException("EdgesVertex::GetPartitionData: partition columns not supported");
+    }
+    // Offset chunks are claimed in order, so the chunk index keeps the output ordered by vertex id
+    return OperatorPartitionData(input.local_state->Cast<EdgesVertexLocalTableFunctionState>().chunk_index);
 }
 //-------------------------------------------------------------------
 // Register
@@ -243,6 +880,13 @@ inline void EdgesVertex::Execute(ClientContext& context, TableFunctionInput& inp
 TableFunction EdgesVertex::GetFunction() {
     TableFunction edges_vertex("edges_vertex", {LogicalType::VARCHAR}, Execute, Bind);
     edges_vertex.init_global = EdgesVertexGlobalTableFunctionState::Init;
+    edges_vertex.init_local = EdgesVertexLocalTableFunctionState::Init;
+    edges_vertex.get_partition_data = GetPartitionData;
+    edges_vertex.statistics = GetStatistics;
+    edges_vertex.cardinality = GetCardinality;
+    edges_vertex.named_parameters["direction"] = LogicalType::VARCHAR;
+    edges_vertex.named_parameters["vertex_type"] = LogicalType::VARCHAR;
+    edges_vertex.named_parameters["per_edge_type"] = LogicalType::BOOLEAN;
 
     // edges_vertex.named_parameters["type"] = LogicalType::VARCHAR;
     edges_vertex.filter_pushdown = true;
@@ -0,0 +1,82 @@
+#include "functions/table/graphar_table_info.hpp"
+
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/function/table_function.hpp>
+
+#include <graphar/graph_info.h>
+
+namespace duckdb {
+//-------------------------------------------------------------------
+// Bind
+//-------------------------------------------------------------------
+unique_ptr<FunctionData> GraphArTableInfo::Bind(ClientContext& context, TableFunctionBindInput& input,
+                                                vector<LogicalType>& return_types, vector<string>& names) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArTableInfo::Bind");
+    const auto file_path = StringValue::Get(input.inputs[0]);
+    auto maybe_graph_info = graphar::GraphInfo::Load(file_path);
+    if (maybe_graph_info.has_error()) {
+        throw IOException("Failed to load graph info from path: %s", file_path);
+    }
+
+    names = {"table_name", "table_type", "bytes", "files", "chunks", "rows", "layout"};
+    return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::BIGINT, LogicalType::BIGINT,
+                    LogicalType::BIGINT,  LogicalType::BIGINT,  LogicalType::LIST(LogicalType::VARCHAR)};
+    return make_uniq<GraphArTableInfoBindData>(maybe_graph_info.value());
+}
+//-------------------------------------------------------------------
+// State Init
+//-------------------------------------------------------------------
+unique_ptr<GlobalTableFunctionState> GraphArTableInfoGlobalTableFunctionState::Init(ClientContext& context,
+                                                                                    TableFunctionInitInput& input) {
+    return make_uniq<GraphArTableInfoGlobalTableFunctionState>();
+}
+//-------------------------------------------------------------------
+// Execute
+//-------------------------------------------------------------------
+void GraphArTableInfo::Execute(ClientContext& context, TableFunctionInput& input, DataChunk& output) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArTableInfo::Execute");
+    auto& gstate = input.global_state->Cast<GraphArTableInfoGlobalTableFunctionState>();
+    if (!gstate.loaded) {
+        const auto& graph_info = input.bind_data->Cast<GraphArTableInfoBindData>().GetGraphInfo();
+        for (const auto& vertex_info : graph_info->GetVertexInfos()) {
+            gstate.tables.emplace_back(GraphArFunctions::GetNameFromInfo(vertex_info), "vertex");
+            gstate.stats.push_back(TableStorageStats::Get(context, graph_info, vertex_info));
+        }
+        for (const auto& edge_info : graph_info->GetEdgeInfos()) {
+            gstate.tables.emplace_back(GraphArFunctions::GetNameFromInfo(edge_info), "edge");
+            gstate.stats.push_back(TableStorageStats::Get(context, graph_info, edge_info));
+        }
+        gstate.loaded = true;
+    }
+
+    idx_t row = 0;
+    for (; gstate.offset < gstate.tables.size() && row < STANDARD_VECTOR_SIZE; ++gstate.offset, ++row) {
+        const auto& stats = gstate.stats[gstate.offset];
+        vector<Value> layout;
+        for (const auto& part : stats.layout) {
+            layout.emplace_back(part);
+        }
+        output.SetValue(0, row, Value(gstate.tables[gstate.offset].first));
+        output.SetValue(1, row, Value(gstate.tables[gstate.offset].second));
+        output.SetValue(2, row, Value::BIGINT(stats.bytes));
+        output.SetValue(3, row, Value::BIGINT(stats.files));
+        output.SetValue(4, row, Value::BIGINT(stats.chunks));
+        output.SetValue(5, row, Value::BIGINT(stats.rows));
+        output.SetValue(6, row, Value::LIST(LogicalType::VARCHAR, std::move(layout)));
+    }
+    output.SetCardinality(row);
+}
+//-------------------------------------------------------------------
+// Register
+//-------------------------------------------------------------------
+TableFunction GraphArTableInfo::GetFunction() {
+    TableFunction graphar_table_info("graphar_table_info", {LogicalType::VARCHAR}, Execute, Bind);
+    graphar_table_info.init_global = GraphArTableInfoGlobalTableFunctionState::Init;
+
+    return graphar_table_info;
+}
+
+void GraphArTableInfo::Register(ExtensionLoader& loader) { loader.RegisterFunction(GetFunction()); }
+}  // namespace duckdb
@@ -8,6 +8,8 @@
 #include <duckdb/common/vector_size.hpp>
 #include <duckdb/function/table_function.hpp>
 
+#include <arrow/compute/api.h>
+
 #include <graphar/api/high_level_reader.h>
 
 #include <iostream>
@@ -26,6 +28,10 @@ unique_ptr<FunctionData> TwoHop::Bind(ClientContext& context, TableFunctionBindI
 
     const auto file_path = StringValue::Get(input.inputs[0]);
     const int64_t vid = IntegerValue::Get(input.named_parameters.at("vid"));
+    auto direction = GraphArDirection::Out;
+    if (input.named_parameters.count("direction")) {
+        direction = ParseDirection(StringValue::Get(input.named_parameters.at("direction")));
+    }
 
     DUCKDB_GRAPHAR_LOG_DEBUG("Load Edge Info");
 
@@ -35,10 +41,54 @@ unique_ptr<FunctionData> TwoHop::Bind(ClientContext& context, TableFunctionBindI
         throw BinderException("No found edge this type");
     }
 
-    DUCKDB_GRAPHAR_LOG_DEBUG("Create BindData");
-
     const std::string prefix = GetDirectory(file_path);
-    auto bind_data = make_uniq<TwoHopBindData>(edge_info, prefix, vid);
+    std::vector<std::string> edge_properties;
+    if (input.named_parameters.count("edge_properties")) {
+        for (const auto& property : ListValue::GetChildren(input.named_parameters.at("edge_properties"))) {
+            edge_properties.push_back(StringValue::Get(property));
+            if (!edge_info->HasProperty(edge_properties.back())) {
+                throw BinderException("Edge property '%s' does not exist", edge_properties.back());
+            }
+        }
+    }
+
+    std::shared_ptr<graphar::VertexInfo> vertex_info;
+    std::string vertex_prefix;
+    std::vector<std::string> vertex_properties;
+    if (input.named_parameters.count("vertex_properties")) {
+        for (const auto& property : ListValue::GetChildren(input.named_parameters.at("vertex_properties"))) {
+            vertex_properties.push_back(StringValue::Get(property));
+        }
+    }
+    if (!vertex_properties.empty()) {
+        DUCKDB_GRAPHAR_LOG_DEBUG("Load Vertex Info");
+        // The reached vertices are destinations of outgoing edges and sources of incoming ones
+        const auto& neighbour_type =
+            direction == GraphArDirection::In ? edge_info->GetSrcType() : edge_info->GetDstType();
+        if (direction == GraphArDirection::Both && edge_info->GetSrcType() != edge_info->GetDstType()) {
+            throw BinderException(
+                "vertex_properties with direction 'both' require the same source and destination type");
+        }
+        std::string vertex_path = prefix + neighbour_type + ".vertex.yaml";
+        if (input.named_parameters.count("vertex_yaml")) {
+            vertex_path = StringValue::Get(input.named_parameters.at("vertex_yaml"));
+        }
+        auto maybe_vertex_info = graphar::VertexInfo::Load(GetYamlContent(vertex_path));
+        if (!maybe_vertex_info.status().ok()) {
+            throw BinderException("Failed to load vertex info of type '%s': %s", neighbour_type,
+                                  maybe_vertex_info.status().message());
+        }
+        vertex_info = maybe_vertex_info.value();
+        if (vertex_info->GetType() != neighbour_type) {
+            throw BinderException("Vertex info has type '%s', expected '%s'", vertex_info->GetType(), neighbour_type);
+        }
+        for (const auto& property : vertex_properties) {
+            if (!vertex_info->HasProperty(property)) {
+                throw BinderException("Vertex property '%s' does not exist", property);
+            }
+        }
+        vertex_prefix = GetDirectory(vertex_path);
+    }
 
     DUCKDB_GRAPHAR_LOG_DEBUG("Set types and names");
 
@@ -46,6 +96,21 @@ unique_ptr<FunctionData> TwoHop::Bind(ClientContext& context, TableFunctionBindI
     names.push_back("_graphArSrcIndex");
     return_types.push_back(LogicalType::BIGINT);
     names.push_back("_graphArDstIndex");
+    for (const auto& property : edge_properties) {
+        return_types.push_back(
+            GraphArFunctions::graphArT2duckT(edge_info->GetPropertyType(property).value()->ToTypeName()));
+        names.push_back(property);
+    }
+    for (const auto& property : vertex_properties) {
+        return_types.push_back(
+            GraphArFunctions::graphArT2duckT(vertex_info->GetPropertyType(property).value()->ToTypeName()));
+        names.push_back("neighbour_" + property);
+    }
+
+    DUCKDB_GRAPHAR_LOG_DEBUG("Create BindData");
+
+    auto bind_data = make_uniq<TwoHopBindData>(edge_info, prefix, vid, direction, std::move(edge_properties),
+                                               vertex_info, vertex_prefix, std::move(vertex_properties));
 
     DUCKDB_GRAPHAR_LOG_DEBUG("Bind finish");
     if (time_logging) {
@@ -72,30 +137,53 @@ unique_ptr<GlobalTableFunctionState> OneMoreHopGlobalTableFunctionState::Init(Cl
 //-------------------------------------------------------------------
 // Execute
 //-------------------------------------------------------------------
+// Writes the hop result to output: the adjacency and edge property columns of table, then the properties of the
+// vertices in its neighbour column
+static void WriteHopResult(const std::shared_ptr<arrow::Table>& table, VertexPropertyLookup* neighbour_lookup,
+                           const int neighbour_column, DataChunk& output) {
+    const int64_t rows = table->num_rows();
+    output.SetCapacity(rows);
+    output.SetCardinality(rows);
+
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns = table->columns();
+    if (neighbour_lookup) {
+        for (auto& array : neighbour_lookup->Lookup(table->column(neighbour_column))) {
+            columns.push_back(std::make_shared<arrow::ChunkedArray>(std::move(array)));
+        }
+    }
+    for (idx_t col_i = 0; col_i < columns.size(); ++col_i) {
+        int64_t row_offset = 0;
+        for (const auto& chunk : columns[col_i]->chunks()) {
+            if (chunk->type_id() == arrow::Type::INT64 && chunk->null_count() == 0) {
+                auto int_array = std::static_pointer_cast<arrow::Int64Array>(chunk);
+                auto data = FlatVector::GetData<int64_t>(output.data[col_i]);
+                std::copy(int_array->raw_values(), int_array->raw_values() + int_array->length(), data + row_offset);
+            } else {
+                for (int64_t i = 0; i < chunk->length(); ++i) {
+                    output.SetValue(col_i, row_offset + i,
+                                    GraphArFunctions::ArrowScalar2DuckValue(chunk->GetScalar(i).ValueOrDie()));
+                }
+            }
+            row_offset += chunk->length();
+        }
+    }
+}
+
 inline void OneHopExecute(TwoHopGlobalState& state, DataChunk& output, const bool time_logging) {
     auto table = state.GetSrcReader().get(STANDARD_VECTOR_SIZE);
+    const int neighbour_column = state.GetSrcReader().neighbour_column();
 
-    output.SetCapacity(table->num_rows());
-    output.SetCardinality(table->num_rows());
+    DUCKDB_GRAPHAR_LOG_DEBUG("OneHopExecute::iterations " + std::to_string(table->num_columns()));
 
-    int num_columns = table->num_columns();
-
-    DUCKDB_GRAPHAR_LOG_DEBUG("OneHopExecute::iterations " + std::to_string(num_columns));
-
-    for (int col_i = 0; col_i < num_columns; ++col_i) {
-        auto column = table->column(col_i);
-        int64_t row_offset = 0;
-        for (const auto& chunk : column->chunks()) {
+    if (state.IsOneHop()) {
+        for (const auto& chunk : table->column(neighbour_column)->chunks()) {
             auto int_array = std::static_pointer_cast<arrow::Int64Array>(chunk);
             for (int64_t i = 0; i < int_array->length(); ++i) {
-                output.SetValue(col_i, row_offset + i, int_array->Value(i));
-                if (state.IsOneHop() && col_i == 1) {
-                    state.AddHopId(int_array->Value(i));
-                }
+                state.AddHopId(int_array->Value(i));
             }
-            row_offset += int_array->length();
         }
     }
+    WriteHopResult(table, state.GetNeighbourLookup(), neighbour_column, output);
 
     DUCKDB_GRAPHAR_LOG_DEBUG("OneHopExecute::Finish " + std::to_string(table->num_rows()));
 }
@@ -121,10 +209,12 @@ inline void TwoHop::Execute(ClientContext& context, TableFunctionInput& input, D
     if (gstate.GetSrcReader().finish()) {
         if (gstate.IsOneHop()) {
             gstate.SetOneHop(false);
+            gstate.DropHopIdsWithoutEdges();
         }
         while (gstate.GetHopI() < gstate.GetHopIds().size() && gstate.GetSrcReader().finish()) {
-            DUCKDB_GRAPHAR_LOG_DEBUG("Find next hop " + std::to_string(gstate.GetHopIds()[gstate.GetHopI()]));
-            gstate.GetSrcReader().find_src(gstate.GetHopIds()[gstate.IncrementHopI()]);
+            const auto vid = gstate.GetHopIds()[gstate.IncrementHopI()];
+            DUCKDB_GRAPHAR_LOG_DEBUG("Find next hop " + std::to_string(vid));
+            gstate.GetSrcReader().find(vid);
         }
     }
 
@@ -136,52 +226,41 @@ inline void TwoHop::Execute(ClientContext& context, TableFunctionInput& input, D
 inline int64_t OneMoreHopExecute(OneMoreHopGlobalState& state, DataChunk& output, const bool time_logging) {
     DUCKDB_GRAPHAR_LOG_DEBUG("OneMoreHopExecute::get " + std::to_string(STANDARD_VECTOR_SIZE));
     auto table = state.src_reader.get(STANDARD_VECTOR_SIZE);
+    const int neighbour_column = state.src_reader.neighbour_column();
 
-    output.SetCapacity(table->num_rows());
-    output.SetCardinality(table->num_rows());
-
-    int num_columns = table->num_columns();
-
-    DUCKDB_GRAPHAR_LOG_DEBUG("OneMoreHopExecute::iterations " + std::to_string(num_columns));
-    std::vector<bool> valid(table->num_rows(), false);
-    int64_t number_valid = 0;
+    DUCKDB_GRAPHAR_LOG_DEBUG("OneMoreHopExecute::iterations " + std::to_string(table->num_columns()));
 
-    for (int col_i = num_columns - 1; col_i >= 0; --col_i) {
-        auto column = table->column(col_i);
-        int64_t row_offset = 0;
-        for (const auto& chunk : column->chunks()) {
-            auto int_array = std::static_pointer_cast<arrow::Int64Array>(chunk);
-            for (int64_t i = 0; i < int_array->length(); ++i) {
-                if (state.one_hop) {
-                    output.SetValue(col_i, row_offset + i, int_array->Value(i));
-                } else {
-                    if (col_i == 1) {
-                        if (state.hop_ids.find(int_array->Value(i)) != state.hop_ids.end()) {
-                            valid[row_offset + i] = true;
-                            output.SetValue(col_i, row_offset + i, int_array->Value(i));
-                            number_valid++;
-                        }
-                    } else {
-                        if (valid[row_offset + i]) {
-                            output.SetValue(col_i, row_offset + i, int_array->Value(i));
-                        }
-                    }
-                }
-
-                if (state.one_hop && col_i == 1) {
-                    state.hop_ids.insert(int_array->Value(i));
-                }
-
-                row_offset += int_array->length();
+    // After the first hop only the edges that lead back into the first hop neighbourhood are kept
+    arrow::BooleanBuilder valid;
+    if (!valid.Reserve(table->num_rows()).ok()) {
+        throw IOException("Failed to filter hop result");
+    }
+    for (const auto& chunk : table->column(neighbour_column)->chunks()) {
+        auto int_array = std::static_pointer_cast<arrow::Int64Array>(chunk);
+        for (int64_t i = 0; i < int_array->length(); ++i) {
+            const auto value = int_array->Value(i);
+            if (state.one_hop) {
+                state.hop_ids.insert(value);
+            } else {
+                valid.UnsafeAppend(state.hop_ids.find(value) != state.hop_ids.end());
             }
         }
     }
+    if (!state.one_hop) {
+        std::shared_ptr<arrow::Array> mask;
+        if (!valid.Finish(&mask).ok()) {
+            throw IOException("Failed to filter hop result");
+        }
+        auto maybe_filtered = arrow::compute::Filter(table, mask);
+        if (!maybe_filtered.ok()) {
+            throw IOException("Failed to filter hop result: " + maybe_filtered.status().message());
+        }
+        table = maybe_filtered.ValueUnsafe().table();
+    }
+    WriteHopResult(table, state.neighbour_lookup.get(), neighbour_column, output);
 
-    output.SetCapacity(number_valid);
-    output.SetCardinality(number_valid);
-
-    DUCKDB_GRAPHAR_LOG_DEBUG("OneMoreHopExecute::Finish " + std::to_string(number_valid));
-    return number_valid;
+    DUCKDB_GRAPHAR_LOG_DEBUG("OneMoreHopExecute::Finish " + std::to_string(table->num_rows()));
+    return table->num_rows();
 }
 
 inline void OneMoreHop::Execute(ClientContext& context, TableFunctionInput& input, DataChunk& output) {
@@ -209,11 +288,14 @@ inline void OneMoreHop::Execute(ClientContext& context, TableFunctionInput& inpu
         if (gstate.src_reader.finish()) {
             if (gstate.one_hop) {
                 gstate.one_hop = false;
+                gstate.DropHopIdsWithoutEdges();
+                gstate.hop_i = gstate.hop_ids.begin();
             }
             while (gstate.hop_i != gstate.hop_ids.end() && gstate.src_reader.finish()) {
-                DUCKDB_GRAPHAR_LOG_DEBUG("Find next hop " + std::to_string(*gstate.hop_i));
-                gstate.src_reader.find_src(*gstate.hop_i);
+                const auto vid = *gstate.hop_i;
                 ++gstate.hop_i;
+                DUCKDB_GRAPHAR_LOG_DEBUG("Find next hop " + std::to_string(vid));
+                gstate.src_reader.find(vid);
             }
         }
     } while (row_count == 0 && !is_one_hop && !gstate.src_reader.finish());
@@ -229,6 +311,10 @@ TableFunction TwoHop::GetFunction() {
     TableFunction read_edges("two_hop", {LogicalType::VARCHAR}, Execute, Bind);
     read_edges.init_global = TwoHopGlobalTableFunctionState::Init;
     read_edges.named_parameters["vid"] = LogicalType::INTEGER;
+    read_edges.named_parameters["direction"] = LogicalType::VARCHAR;
+    read_edges.named_parameters["edge_properties"] = LogicalType::LIST(LogicalType::VARCHAR);
+    read_edges.named_parameters["vertex_properties"] = LogicalType::LIST(LogicalType::VARCHAR);
+    read_edges.named_parameters["vertex_yaml"] = LogicalType::VARCHAR;
 
     //	read_edges.filter_pushdown = true;
 
@@ -241,6 +327,10 @@ TableFunction OneMoreHop::GetFunction() {
     TableFunction read_edges("one_more_hop", {LogicalType::VARCHAR}, Execute, TwoHop::Bind);
     read_edges.init_global = OneMoreHopGlobalTableFunctionState::Init;
     read_edges.named_parameters["vid"] = LogicalType::INTEGER;
+    read_edges.named_parameters["direction"] = LogicalType::VARCHAR;
+    read_edges.named_parameters["edge_properties"] = LogicalType::LIST(LogicalType::VARCHAR);
+    read_edges.named_parameters["vertex_properties"] = LogicalType::LIST(LogicalType::VARCHAR);
+    read_edges.named_parameters["vertex_yaml"] = LogicalType::VARCHAR;
 
     //	read_edges.filter_pushdown = true;
 
@@ -1,14 +1,19 @@
 #include "functions/table/read_edges.hpp"
 
 #include "utils/benchmark.hpp"
+#include "utils/degree_index.hpp"
+#include "utils/edge_delta.hpp"
 #include "utils/func.hpp"
 
 #include <arrow/c/bridge.h>
 
+#include <duckdb/common/file_system.hpp>
 #include <duckdb/common/named_parameter_map.hpp>
+#include <duckdb/common/string_util.hpp>
 #include <duckdb/function/table/arrow.hpp>
 #include <duckdb/function/table_function.hpp>
 #include <duckdb/planner/expression/bound_comparison_expression.hpp>
+#include <duckdb/storage/statistics/node_statistics.hpp>
 
 #include <graphar/api/arrow_reader.h>
 #include <graphar/api/high_level_reader.h>
@@ -27,6 +32,30 @@ void ReadEdges::SetBindData(std::shared_ptr<graphar::GraphInfo> graph_info, cons
     DUCKDB_GRAPHAR_LOG_TRACE("ReadEdges::SetBindData");
     ReadBase::SetBindData(graph_info, edge_info, bind_data, "read_edges", 0, 1, {SRC_GID_COLUMN, DST_GID_COLUMN});
 }
+
+void ReadEdges::SetDeltaChunkNum(ClientContext& context, ReadBindData& bind_data) {
+    const auto& graph_info = bind_data.graph_info;
+    const auto edge_info = graph_info->GetEdgeInfo(bind_data.params[0], bind_data.params[1], bind_data.params[2]);
+    bind_data.delta_chunk_num =
+        EdgeDelta::GetChunkNum(FileSystem::GetFileSystem(context), graph_info->GetPrefix(), *edge_info);
+}
+
+void ReadEdges::SetEdgeCount(ClientContext& context, ReadBindData& bind_data) {
+    bind_data.edge_count = optional_idx();
+    if (bind_data.delta_chunk_num > 0) {
+        // degree indexes miss the inserted edges until a checkpoint
+        return;
+    }
+    const auto& graph_info = bind_data.graph_info;
+    const auto edge_info = graph_info->GetEdgeInfo(bind_data.params[0], bind_data.params[1], bind_data.params[2]);
+    for (auto adj_list_type : {graphar::AdjListType::ordered_by_source, graphar::AdjListType::ordered_by_dest}) {
+        auto index = DegreeIndex::Open(context, edge_info, graph_info->GetPrefix(), adj_list_type);
+        if (index) {
+            bind_data.edge_count = static_cast<idx_t>(index->GetSummary().sum);
+            return;
+        }
+    }
+}
 //-------------------------------------------------------------------
 // Bind
 //-------------------------------------------------------------------
@@ -42,6 +71,15 @@ unique_ptr<FunctionData> ReadEdges::Bind(ClientContext& context, TableFunctionBi
     const std::string src_type = StringValue::Get(input.named_parameters.at("src"));
     const std::string dst_type = StringValue::Get(input.named_parameters.at("dst"));
     const std::string e_type = StringValue::Get(input.named_parameters.at("type"));
+    auto adj_list_type = graphar::AdjListType::ordered_by_source;
+    if (input.named_parameters.count("ordered_by")) {
+        const auto ordered_by = StringUtil::Lower(StringValue::Get(input.named_parameters.at("ordered_by")));
+        if (ordered_by == "dst") {
+            adj_list_type = graphar::AdjListType::ordered_by_dest;
+        } else if (ordered_by != "src") {
+            throw BinderException("ordered_by must be 'src' or 'dst', got '%s'", ordered_by);
+        }
+    }
 
     DUCKDB_GRAPHAR_LOG_DEBUG(src_type + "--" + e_type + "->" + dst_type + "\nLoad Graph Info and Edge Info");
 
@@ -61,6 +99,12 @@ unique_ptr<FunctionData> ReadEdges::Bind(ClientContext& context, TableFunctionBi
     DUCKDB_GRAPHAR_LOG_DEBUG("Fill bind data");
 
     SetBindData(graph_info, *edge_info, bind_data);
+    if (!edge_info->HasAdjacentListType(adj_list_type)) {
+        throw BinderException("Edges have no %s adjacency list", std::string(AdjListTypeToString(adj_list_type)));
+    }
+    bind_data->adj_list_type = adj_list_type;
+    SetDeltaChunkNum(context, *bind_data);
+    SetEdgeCount(context, *bind_data);
 
     names = bind_data->flatten_prop_names;
     std::transform(bind_data->flatten_prop_types.begin(), bind_data->flatten_prop_types.end(),
@@ -81,7 +125,9 @@ std::shared_ptr<Reader> ReadEdges::GetReader(ReadBaseGlobalTableFunctionState& g
                                              idx_t ind, const std::string& filter_column) {
     DUCKDB_GRAPHAR_LOG_TRACE("ReadEdges::GetReader");
     graphar::AdjListType adj_list_type;
-    if (filter_column == "" or filter_column == SRC_GID_COLUMN) {
+    if (filter_column == "") {
+        adj_list_type = bind_data.adj_list_type;
+    } else if (filter_column == SRC_GID_COLUMN) {
         adj_list_type = graphar::AdjListType::ordered_by_source;
     } else if (filter_column == DST_GID_COLUMN) {
         adj_list_type = graphar::AdjListType::ordered_by_dest;
@@ -111,6 +157,68 @@ std::shared_ptr<Reader> ReadEdges::GetReader(ReadBaseGlobalTableFunctionState& g
     return std::make_shared<Reader>(std::move(result));
 }
 //-------------------------------------------------------------------
+// GetPartitions
+//-------------------------------------------------------------------
+vector<std::pair<graphar::IdType, graphar::IdType>> ReadEdges::GetPartitions(const ReadBindData& bind_data) {
+    DUCKDB_GRAPHAR_LOG_TRACE("ReadEdges::GetPartitions");
+    const auto& graph_info = bind_data.graph_info;
+    auto edge_info = graph_info->GetEdgeInfo(bind_data.params[0], bind_data.params[1], bind_data.params[2]);
+    const auto& prefix = graph_info->GetPrefix();
+    GAR_ASSIGN_OR_RAISE_ERROR(auto vertex_chunk_num,
+                              graphar::util::GetVertexChunkNum(prefix, edge_info, bind_data.adj_list_type));
+    vector<std::pair<graphar::IdType, graphar::IdType>> partitions;
+    for (graphar::IdType vertex_chunk_index = 0; vertex_chunk_index < vertex_chunk_num; ++vertex_chunk_index) {
+        GAR_ASSIGN_OR_RAISE_ERROR(
+            auto chunk_num,
+            graphar::util::GetEdgeChunkNum(prefix, edge_info, bind_data.adj_list_type, vertex_chunk_index));
+        for (graphar::IdType chunk_index = 0; chunk_index < chunk_num; ++chunk_index) {
+            partitions.emplace_back(vertex_chunk_index, chunk_index);
+        }
+    }
+    for (idx_t delta_chunk = 0; delta_chunk < bind_data.delta_chunk_num; ++delta_chunk) {
+        partitions.emplace_back(DELTA_PARTITION, delta_chunk);
+    }
+    return partitions;
+}
+
+// Rows of a full partition; the last edge chunk of a vertex chunk may have fewer
+idx_t ReadEdges::GetPartitionRows(const ReadBindData& bind_data) {
+    return bind_data.graph_info->GetEdgeInfo(bind_data.params[0], bind_data.params[1], bind_data.params[2])
+        ->GetChunkSize();
+}
+
+graphar::Status ReadEdges::SeekPartition(Reader& reader, const ReadBindData& bind_data,
+                                         const std::pair<graphar::IdType, graphar::IdType>& partition) {
+    return seek_chunk_index(reader, partition.first, partition.second);
+}
+std::shared_ptr<arrow::Table> ReadEdges::ReadDeltaChunk(const ReadBindData& bind_data, graphar::IdType chunk) {
+    const auto& graph_info = bind_data.graph_info;
+    auto edge_info = graph_info->GetEdgeInfo(bind_data.params[0], bind_data.params[1], bind_data.params[2]);
+    return EdgeDelta::ReadChunk(graph_info->GetPrefix(), *edge_info, chunk);
+}
+// Adjacency list or property chunk file of a reader, empty when it is not Parquet
+std::string ReadEdges::GetChunkFilePath(const ReadBindData& bind_data, idx_t ind, const ChunkRowPosition& position) {
+    const auto edge_info =
+        bind_data.graph_info->GetEdgeInfo(bind_data.params[0], bind_data.params[1], bind_data.params[2]);
+    const auto adj_list_type = bind_data.filter_column == DST_GID_COLUMN ? graphar::AdjListType::ordered_by_dest
+                                                                          : graphar::AdjListType::ordered_by_source;
+    if (ind == 0) {
+        if (edge_info->GetAdjacentList(adj_list_type)->GetFileType() != graphar::FileType::PARQUET) {
+            return "";
+        }
+        GAR_ASSIGN_OR_RAISE_ERROR(auto path,
+                                  edge_info->GetAdjListFilePath(position.vertex_chunk, position.chunk, adj_list_type));
+        return path;
+    }
+    const auto& pg = bind_data.pgs[ind - 1];
+    if (pg->GetFileType() != graphar::FileType::PARQUET) {
+        return "";
+    }
+    GAR_ASSIGN_OR_RAISE_ERROR(
+        auto path, edge_info->GetPropertyFilePath(pg, adj_list_type, position.vertex_chunk, position.chunk));
+    return path;
+}
+//-------------------------------------------------------------------
 // SetFilter
 //-------------------------------------------------------------------
 int64_t get_distance(int64_t vid_from_offset, int64_t vid_to_offset, int64_t vid_from_chunk_index,
@@ -156,6 +264,9 @@ void ReadEdges::SetFilter(ReadBaseGlobalTableFunctionState& gstate, ReadBindData
     }
     auto vid_from_offset = GetInt64Value(offset_arr, 0);
     auto vid_from_chunk_index = offset_reader->GetChunkIndex();
+    const auto edge_chunk_size = edge_info->GetChunkSize();
+    gstate.filter_position = {vid_from_chunk_index, vid_from_offset / edge_chunk_size,
+                              static_cast<idx_t>(vid_from_offset % edge_chunk_size)};
     int64_t distance = vid_to_offset - vid_from_offset;
     auto now = vid_from_chunk_index;
     while (now < vid_to_chunk_index) {
@@ -192,11 +303,27 @@ unique_ptr<BaseStatistics> ReadEdges::GetStatistics(ClientContext& context, cons
     return stats.ToUnique();
 }
 //-------------------------------------------------------------------
+// GetCardinality
+//-------------------------------------------------------------------
+unique_ptr<NodeStatistics> ReadEdges::GetCardinality(ClientContext& context, const FunctionData* bind_data) {
+    DUCKDB_GRAPHAR_LOG_TRACE("ReadEdges::GetCardinality");
+    auto& read_bind_data = bind_data->Cast<ReadBindData>();
+    if (!read_bind_data.edge_count.IsValid()) {
+        return nullptr;
+    }
+    const auto edge_count = read_bind_data.edge_count.GetIndex();
+    return make_uniq<NodeStatistics>(edge_count, edge_count);
+}
+//-------------------------------------------------------------------
 // PushdownComplexFilter
 //-------------------------------------------------------------------
 void ReadEdges::PushdownComplexFilter(ClientContext& context, LogicalGet& get, FunctionData* bind_data,
                                       vector<unique_ptr<Expression>>& filters) {
     DUCKDB_GRAPHAR_LOG_TRACE("ReadEdges::PushdownComplexFilter");
+    if (bind_data->Cast<ReadBindData>().delta_chunk_num > 0) {
+        // the offsets only cover the sorted chunks, the delta chunks are scanned and filtered by DuckDB
+        return;
+    }
     vector<unique_ptr<Expression>> filters_new;
     bool already_pushed = false;
     for (auto& filter : filters) {
@@ -235,14 +362,18 @@ void ReadEdges::PushdownComplexFilter(ClientContext& context, LogicalGet& get, F
 TableFunction ReadEdges::GetFunction() {
     TableFunction read_edges("read_edges", {LogicalType::VARCHAR}, Execute, Bind);
     read_edges.init_global = ReadEdges::Init;
+    read_edges.init_local = ReadEdges::InitLocal;
+    read_edges.get_partition_data = ReadEdges::GetPartitionData;
 
     read_edges.named_parameters["src"] = LogicalType::VARCHAR;
     read_edges.named_parameters["dst"] = LogicalType::VARCHAR;
     read_edges.named_parameters["type"] = LogicalType::VARCHAR;
+    read_edges.named_parameters["ordered_by"] = LogicalType::VARCHAR;
 
     read_edges.filter_pushdown = false;
     read_edges.projection_pushdown = true;
     read_edges.statistics = ReadEdges::GetStatistics;
+    read_edges.cardinality = ReadEdges::GetCardinality;
     read_edges.pushdown_complex_filter = ReadEdges::PushdownComplexFilter;
 
     return read_edges;
@@ -253,10 +384,13 @@ TableFunction ReadEdges::GetFunction() {
 TableFunction ReadEdges::GetScanFunction() {
     TableFunction read_edges({}, Execute, Bind);
     read_edges.init_global = ReadEdges::Init;
+    read_edges.init_local = ReadEdges::InitLocal;
+    read_edges.get_partition_data = ReadEdges::GetPartitionData;
 
     read_edges.filter_pushdown = false;
     read_edges.projection_pushdown = true;
     read_edges.statistics = ReadEdges::GetStatistics;
+    read_edges.cardinality = ReadEdges::GetCardinality;
     read_edges.pushdown_complex_filter = ReadEdges::PushdownComplexFilter;
 
     return read_edges;
@@ -2,13 +2,17 @@
 
 #include "utils/benchmark.hpp"
 #include "utils/func.hpp"
+#include "utils/vertex_key_index.hpp"
 
 #include <arrow/c/bridge.h>
 
 #include <duckdb/common/named_parameter_map.hpp>
 #include <duckdb/function/table/arrow.hpp>
 #include <duckdb/function/table_function.hpp>
+#include <duckdb/planner/expression/bound_columnref_expression.hpp>
 #include <duckdb/planner/expression/bound_comparison_expression.hpp>
+#include <duckdb/planner/expression/bound_constant_expression.hpp>
+#include <duckdb/planner/operator/logical_get.hpp>
 
 #include <graphar/api/arrow_reader.h>
 #include <graphar/api/high_level_reader.h>
@@ -88,6 +92,40 @@ std::shared_ptr<Reader> ReadVertices::GetReader(ReadBaseGlobalTableFunctionState
     return std::make_shared<Reader>(std::move(result));
 }
 //-------------------------------------------------------------------
+// GetPartitions
+//-------------------------------------------------------------------
+vector<std::pair<graphar::IdType, graphar::IdType>> ReadVertices::GetPartitions(const ReadBindData& bind_data) {
+    DUCKDB_GRAPHAR_LOG_TRACE("ReadVertices::GetPartitions");
+    const auto vertex_num = GraphArFunctions::GetVertexNum(bind_data.graph_info, bind_data.params[0]);
+    const auto chunk_size = bind_data.graph_info->GetVertexInfo(bind_data.params[0])->GetChunkSize();
+    vector<std::pair<graphar::IdType, graphar::IdType>> partitions;
+    for (graphar::IdType chunk_index = 0; chunk_index * chunk_size < vertex_num; ++chunk_index) {
+        partitions.emplace_back(chunk_index, 0);
+    }
+    return partitions;
+}
+
+// Rows of a full partition; the last vertex chunk may have fewer
+idx_t ReadVertices::GetPartitionRows(const ReadBindData& bind_data) {
+    return bind_data.graph_info->GetVertexInfo(bind_data.params[0])->GetChunkSize();
+}
+
+graphar::Status ReadVertices::SeekPartition(Reader& reader, const ReadBindData& bind_data,
+                                            const std::pair<graphar::IdType, graphar::IdType>& partition) {
+    const auto chunk_size = bind_data.graph_info->GetVertexInfo(bind_data.params[0])->GetChunkSize();
+    return seek_vid(reader, partition.first * chunk_size, GID_COLUMN_INTERNAL);
+}
+// Chunk file of the property group of a reader, empty when it is not Parquet
+std::string ReadVertices::GetChunkFilePath(const ReadBindData& bind_data, idx_t ind, const ChunkRowPosition& position) {
+    const auto& pg = bind_data.pgs[ind];
+    if (pg->GetFileType() != graphar::FileType::PARQUET) {
+        return "";
+    }
+    const auto vertex_info = bind_data.graph_info->GetVertexInfo(bind_data.params[0]);
+    GAR_ASSIGN_OR_RAISE_ERROR(auto path, vertex_info->GetFilePath(pg, position.vertex_chunk));
+    return path;
+}
+//-------------------------------------------------------------------
 // SetFilter
 //-------------------------------------------------------------------
 void ReadVertices::SetFilter(ReadBaseGlobalTableFunctionState& gstate, ReadBindData& bind_data,
@@ -100,6 +138,8 @@ void ReadVertices::SetFilter(ReadBaseGlobalTableFunctionState& gstate, ReadBindD
         for (idx_t i = 0; i < gstate.readers.size(); ++i) {
             seek_vid(*gstate.readers[i], vid_range.first, filter_column);
         }
+        const auto chunk_size = bind_data.graph_info->GetVertexInfo(bind_data.params[0])->GetChunkSize();
+        gstate.filter_position = {vid_range.first / chunk_size, 0, static_cast<idx_t>(vid_range.first % chunk_size)};
         gstate.filter_range.first = 0;
         gstate.filter_range.second = vid_range.second - vid_range.second + 1;
     } else {
@@ -166,6 +206,60 @@ void ReadVertices::PushdownComplexFilter(ClientContext& context, LogicalGet& get
         }
     }
     filters = std::move(filters_new);
+    auto& read_bind_data = bind_data->Cast<ReadBindData>();
+    if (read_bind_data.filter_column.empty()) {
+        PushdownKeyFilter(context, get, read_bind_data, filters);
+    }
+}
+
+// Turns an equality filter on the primary key into a seek to the vertex the key index finds. The filter stays: string
+// keys are indexed by hash, and when no vertex has the key the seek only reads the first vertex for the filter to drop.
+void ReadVertices::PushdownKeyFilter(ClientContext& context, LogicalGet& get, ReadBindData& bind_data,
+                                     const vector<unique_ptr<Expression>>& filters) {
+    const auto vertex_info = bind_data.graph_info->GetVertexInfo(bind_data.params[0]);
+    const auto key = VertexKeyIndex::GetPrimaryKey(*vertex_info);
+    if (key.empty()) {
+        return;
+    }
+    for (auto& filter : filters) {
+        if (filter->GetExpressionType() != ExpressionType::COMPARE_EQUAL) {
+            continue;
+        }
+        auto& comparison = filter->Cast<BoundComparisonExpression>();
+        auto* column = comparison.left.get();
+        auto* constant = comparison.right.get();
+        if (column->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+            std::swap(column, constant);
+        }
+        if (column->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF ||
+            constant->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+            continue;
+        }
+        auto& column_ref = column->Cast<BoundColumnRefExpression>();
+        const auto& column_ids = get.GetColumnIds();
+        if (column_ref.binding.table_index != get.table_index || column_ref.binding.column_index >= column_ids.size()) {
+            continue;
+        }
+        const auto& column_index = column_ids[column_ref.binding.column_index];
+        if (column_index.IsRowIdColumn() || get.names[column_index.GetPrimaryIndex()] != key) {
+            continue;
+        }
+        const auto vertex_num = GraphArFunctions::GetVertexNum(bind_data.graph_info, bind_data.params[0]);
+        auto index = VertexKeyIndex::Open(context, bind_data.graph_info, bind_data.params[0], key);
+        if (!index || vertex_num == 0) {
+            return;
+        }
+        // a second match means a non-unique key or a hash collision, which one seek cannot cover
+        const auto vids = index->Lookup(constant->Cast<BoundConstantExpression>().value, 2);
+        if (vids.size() > 1) {
+            return;
+        }
+        const graphar::IdType vid = vids.empty() ? 0 : vids[0];
+        DUCKDB_GRAPHAR_LOG_DEBUG("Key " + key + " filter seeks to vertex " + std::to_string(vid));
+        bind_data.vid_range = std::make_pair(vid, vid);
+        bind_data.filter_column = GID_COLUMN_INTERNAL;
+        return;
+    }
 }
 //-------------------------------------------------------------------
 // GetFunction
@@ -173,6 +267,8 @@ void ReadVertices::PushdownComplexFilter(ClientContext& context, LogicalGet& get
 TableFunction ReadVertices::GetFunction() {
     TableFunction read_vertices("read_vertices", {LogicalType::VARCHAR}, Execute, Bind);
     read_vertices.init_global = ReadVertices::Init;
+    read_vertices.init_local = ReadVertices::InitLocal;
+    read_vertices.get_partition_data = ReadVertices::GetPartitionData;
 
     read_vertices.named_parameters["type"] = LogicalType::VARCHAR;
 
@@ -189,6 +285,8 @@ TableFunction ReadVertices::GetFunction() {
 TableFunction ReadVertices::GetScanFunction() {
     TableFunction read_vertices({}, Execute, Bind);
     read_vertices.init_global = ReadVertices::Init;
+    read_vertices.init_local = ReadVertices::InitLocal;
+    read_vertices.get_partition_data = ReadVertices::GetPartitionData;
 
     read_vertices.filter_pushdown = false;
     read_vertices.projection_pushdown = true;
@@ -0,0 +1,63 @@
+#include "optimizer/graphar_scan_limit.hpp"
+
+#include "functions/table/read_base.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/planner/operator/logical_get.hpp>
+#include <duckdb/planner/operator/logical_limit.hpp>
+
+namespace duckdb {
+// The GraphAr scan whose rows reach op one for one: projections keep the row count, anything else may not
+static optional_ptr<LogicalGet> FindScan(LogicalOperator& op) {
+    switch (op.type) {
+        case LogicalOperatorType::LOGICAL_PROJECTION:
+            return FindScan(*op.children[0]);
+        case LogicalOperatorType::LOGICAL_GET: {
+            auto& get = op.Cast<LogicalGet>();
+            if (!get.bind_data || !dynamic_cast<ReadBindData*>(get.bind_data.get()) ||
+                !get.table_filters.filters.empty()) {
+                return nullptr;
+            }
+            return &get;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+static void PushLimits(LogicalOperator& op) {
+    for (auto& child : op.children) {
+        PushLimits(*child);
+    }
+    if (op.type != LogicalOperatorType::LOGICAL_LIMIT) {
+        return;
+    }
+    auto& limit = op.Cast<LogicalLimit>();
+    if (limit.limit_val.Type() != LimitNodeType::CONSTANT_VALUE ||
+        (limit.offset_val.Type() != LimitNodeType::UNSET && limit.offset_val.Type() != LimitNodeType::CONSTANT_VALUE)) {
+        return;
+    }
+    auto get = FindScan(*op.children[0]);
+    if (!get) {
+        return;
+    }
+    idx_t rows = limit.limit_val.GetConstantValue();
+    if (limit.offset_val.Type() == LimitNodeType::CONSTANT_VALUE) {
+        rows += limit.offset_val.GetConstantValue();
+    }
+    DUCKDB_GRAPHAR_LOG_DEBUG("Limiting GraphAr scan to " + std::to_string(rows) + " rows");
+    get->bind_data->Cast<ReadBindData>().SetRowLimit(rows);
+}
+
+void GraphArScanLimit::Optimize(OptimizerExtensionInput& input, unique_ptr<LogicalOperator>& plan) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArScanLimit::Optimize");
+    PushLimits(*plan);
+}
+
+OptimizerExtension GraphArScanLimit::GetExtension() {
+    OptimizerExtension extension;
+    extension.optimize_function = Optimize;
+    return extension;
+}
+
+}  // namespace duckdb
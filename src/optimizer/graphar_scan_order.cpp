@@ -0,0 +1,104 @@
+#include "optimizer/graphar_scan_order.hpp"
+
+#include "functions/table/read_base.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/main/config.hpp>
+#include <duckdb/planner/expression/bound_columnref_expression.hpp>
+#include <duckdb/planner/operator/logical_get.hpp>
+#include <duckdb/planner/operator/logical_limit.hpp>
+#include <duckdb/planner/operator/logical_order.hpp>
+#include <duckdb/planner/operator/logical_projection.hpp>
+#include <duckdb/planner/operator/logical_top_n.hpp>
+
+namespace duckdb {
+// Follows a column binding down through projections and filters, which keep the row order, to the GraphAr scan
+// producing it; column is set to the name of the scanned column
+static optional_ptr<LogicalGet> FindScan(LogicalOperator& op, const ColumnBinding& binding, std::string& column) {
+    switch (op.type) {
+        case LogicalOperatorType::LOGICAL_PROJECTION: {
+            auto& projection = op.Cast<LogicalProjection>();
+            if (binding.table_index != projection.table_index) {
+                return nullptr;
+            }
+            auto& expression = *projection.expressions[binding.column_index];
+            if (expression.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+                return nullptr;
+            }
+            return FindScan(*op.children[0], expression.Cast<BoundColumnRefExpression>().binding, column);
+        }
+        case LogicalOperatorType::LOGICAL_FILTER:
+            return FindScan(*op.children[0], binding, column);
+        case LogicalOperatorType::LOGICAL_GET: {
+            auto& get = op.Cast<LogicalGet>();
+            if (binding.table_index != get.table_index || !get.bind_data ||
+                !dynamic_cast<ReadBindData*>(get.bind_data.get())) {
+                return nullptr;
+            }
+            const auto& column_ids = get.GetColumnIds();
+            if (binding.column_index >= column_ids.size() ||
+                column_ids[binding.column_index].GetPrimaryIndex() >= get.names.size()) {
+                return nullptr;
+            }
+            column = get.names[column_ids[binding.column_index].GetPrimaryIndex()];
+            return &get;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+// Whether the child already produces the order, possibly after switching its scan to another adjacency list
+static bool HasScanOrder(LogicalOperator& child, const vector<BoundOrderByNode>& orders) {
+    if (orders.size() != 1 || orders[0].type != OrderType::ASCENDING ||
+        orders[0].expression->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+        return false;
+    }
+    std::string column;
+    auto get = FindScan(child, orders[0].expression->Cast<BoundColumnRefExpression>().binding, column);
+    if (!get) {
+        return false;
+    }
+    auto& bind_data = get->bind_data->Cast<ReadBindData>();
+    return column == bind_data.GetOrderColumn() || bind_data.SetOrderColumn(column);
+}
+
+static void RemoveScanOrders(unique_ptr<LogicalOperator>& op) {
+    for (auto& child : op->children) {
+        RemoveScanOrders(child);
+    }
+    if (op->type == LogicalOperatorType::LOGICAL_ORDER_BY) {
+        auto& order = op->Cast<LogicalOrder>();
+        if (order.projection_map.empty() && HasScanOrder(*op->children[0], order.orders)) {
+            DUCKDB_GRAPHAR_LOG_DEBUG("Removing ORDER BY over an ordered GraphAr scan");
+            op = std::move(op->children[0]);
+        }
+    } else if (op->type == LogicalOperatorType::LOGICAL_TOP_N) {
+        auto& top_n = op->Cast<LogicalTopN>();
+        if (HasScanOrder(*op->children[0], top_n.orders)) {
+            DUCKDB_GRAPHAR_LOG_DEBUG("Replacing top-n over an ordered GraphAr scan with a limit");
+            auto limit = make_uniq<LogicalLimit>(
+                BoundLimitNode::ConstantValue(static_cast<int64_t>(top_n.limit)),
+                top_n.offset ? BoundLimitNode::ConstantValue(static_cast<int64_t>(top_n.offset)) : BoundLimitNode());
+            limit->children.push_back(std::move(op->children[0]));
+            op = std::move(limit);
+        }
+    }
+}
+
+void GraphArScanOrder::Optimize(OptimizerExtensionInput& input, unique_ptr<LogicalOperator>& plan) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArScanOrder::Optimize");
+    // Parallel scans only keep their order in the result when insertion order is preserved
+    if (!DBConfig::GetConfig(input.context).options.preserve_insertion_order) {
+        return;
+    }
+    RemoveScanOrders(plan);
+}
+
+OptimizerExtension GraphArScanOrder::GetExtension() {
+    OptimizerExtension extension;
+    extension.optimize_function = Optimize;
+    return extension;
+}
+
+}  // namespace duckdb
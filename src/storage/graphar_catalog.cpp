@@ -1,30 +1,38 @@
 #include "storage/graphar_catalog.hpp"
 
+#include "storage/graphar_create_index.hpp"
+#include "storage/graphar_insert.hpp"
 #include "storage/graphar_schema_entry.hpp"
 #include "storage/graphar_table_entry.hpp"
+#include "storage/graphar_table_information.hpp"
 #include "storage/graphar_transaction.hpp"
+#include "utils/func.hpp"
 #include "utils/global_log_manager.hpp"
+#include "utils/table_storage_stats.hpp"
+#include "utils/vertex_key_index.hpp"
 
+#include <duckdb/catalog/catalog_search_path.hpp>
 #include <duckdb/common/exception/transaction_exception.hpp>
+#include <duckdb/common/string_util.hpp>
+#include <duckdb/main/client_data.hpp>
+#include <duckdb/parser/expression/columnref_expression.hpp>
+#include <duckdb/parser/parsed_data/create_index_info.hpp>
 #include <duckdb/parser/parsed_data/create_schema_info.hpp>
+#include <duckdb/parser/statement/create_statement.hpp>
+#include <duckdb/execution/physical_plan_generator.hpp>
 #include <duckdb/parser/parsed_data/create_table_info.hpp>
+#include <duckdb/planner/operator/logical_insert.hpp>
 #include <duckdb/storage/database_size.hpp>
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 
 namespace duckdb {
 GraphArCatalog::GraphArCatalog(AttachedDatabase& db_p, const std::string& path_,
-                               std::shared_ptr<graphar::GraphInfo>& graph_info_, ClientContext& context,
-                               std::string& database_name)
-    : Catalog(db_p),
-      path(path_),
-      graph_info(graph_info_),
-      client_data(ClientData::Get(context)),
-      database_name(database_name) {
+                               std::shared_ptr<graphar::GraphInfo>& graph_info_, const std::string& database_name)
+    : Catalog(db_p), path(path_), graph_info(graph_info_), database_name(database_name) {
     DUCKDB_GRAPHAR_LOG_TRACE("GraphArCatalog::GraphArCatalog");
-    CatalogSearchEntry entry(database_name, "main");
-    client_data.catalog_search_path->Set({entry}, CatalogSetPathType::SET_DIRECTLY);
 }
 
 GraphArCatalog::~GraphArCatalog() = default;
@@ -54,13 +62,58 @@ bool GraphArCatalog::InMemory() { return in_memory; }
 
 string GraphArCatalog::GetDBPath() { return path; }
 
+void GraphArCatalog::OnDetach(ClientContext& context) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArCatalog::OnDetach");
+    auto& search_path = *ClientData::Get(context).catalog_search_path;
+    auto paths = search_path.GetSetPaths();
+    const auto path_count = paths.size();
+    paths.erase(std::remove_if(paths.begin(), paths.end(),
+                               [&](const CatalogSearchEntry& entry) {
+                                   return StringUtil::CIEquals(entry.catalog, database_name);
+                               }),
+                paths.end());
+    if (paths.size() != path_count) {
+        search_path.Set(std::move(paths), CatalogSetPathType::SET_DIRECTLY);
+    }
+}
+
+std::string GraphArCatalog::GetCachePath() const {
+    return GetDirectory(path) + graph_info->GetName() + ".cache.duckdb";
+}
+
+void GraphArCatalog::LockWriter(GraphArTransaction& transaction) {
+    lock_guard<mutex> guard(writer_lock);
+    if (writer && writer.get() != &transaction) {
+        throw TransactionException("Cannot write to GraphAr graph \"%s\": another transaction is writing to it",
+                                   database_name);
+    }
+    writer = &transaction;
+}
+
+void GraphArCatalog::UnlockWriter(GraphArTransaction& transaction) {
+    lock_guard<mutex> guard(writer_lock);
+    if (writer.get() == &transaction) {
+        writer = nullptr;
+    }
+}
+
 void GraphArCatalog::DropSchema(ClientContext& context, DropInfo& info) {
     throw NotImplementedException("GraphArCatalog::DropSchema");
 }
 
 PhysicalOperator& GraphArCatalog::PlanInsert(ClientContext& context, PhysicalPlanGenerator& planner, LogicalInsert& op,
                                              optional_ptr<PhysicalOperator> plan) {
-    throw NotImplementedException("GraphArCatalog::PlanInsert");
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArCatalog::PlanInsert");
+    if (op.return_chunk) {
+        throw BinderException("RETURNING is not supported when inserting into a GraphAr graph");
+    }
+    if (op.action_type != OnConflictAction::THROW) {
+        throw BinderException("ON CONFLICT is not supported when inserting into a GraphAr graph");
+    }
+    D_ASSERT(plan);
+    auto& insert = planner.Make<GraphArInsert>(op, op.table.Cast<GraphArTableEntry>(), op.column_index_map);
+    insert.children.push_back(*plan);
+    return insert;
 }
 PhysicalOperator& GraphArCatalog::PlanCreateTableAs(ClientContext& context, PhysicalPlanGenerator& planner,
                                                     LogicalCreateTable& op, PhysicalOperator& plan) {
@@ -77,11 +130,39 @@ PhysicalOperator& GraphArCatalog::PlanUpdate(ClientContext& context, PhysicalPla
 unique_ptr<LogicalOperator> GraphArCatalog::BindCreateIndex(Binder& binder, CreateStatement& stmt,
                                                             TableCatalogEntry& table,
                                                             unique_ptr<LogicalOperator> plan) {
-    throw NotImplementedException("GraphArCatalog::BindCreateIndex");
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArCatalog::BindCreateIndex");
+    auto& graphar_table = table.Cast<GraphArTableEntry>();
+    auto table_info = graphar_table.GetTableInfo();
+    if (table_info->GetType() != GraphArTableType::Vertex) {
+        throw BinderException("Indexes are only supported on the primary key of GraphAr vertex tables");
+    }
+    const auto key = VertexKeyIndex::GetPrimaryKey(*graph_info->GetVertexInfo(table_info->GetParams()[0]));
+    const auto& expressions = stmt.info->Cast<CreateIndexInfo>().expressions;
+    if (expressions.size() != 1 || expressions[0]->GetExpressionClass() != ExpressionClass::COLUMN_REF ||
+        expressions[0]->Cast<ColumnRefExpression>().GetColumnName() != key) {
+        throw BinderException("GraphAr vertex table \"%s\" can only be indexed on its primary key%s", table.name,
+                              key.empty() ? ", and it has none" : " \"" + key + "\"");
+    }
+    return make_uniq<LogicalGraphArCreateIndex>(graphar_table, key);
 }
 
 DatabaseSize GraphArCatalog::GetDatabaseSize(ClientContext& context) {
-    throw NotImplementedException("GraphArCatalog::GetDatabaseSize");
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArCatalog::GetDatabaseSize");
+    DatabaseSize result;
+    result.bytes = 0;
+    for (const auto& vertex_info : graph_info->GetVertexInfos()) {
+        result.bytes += TableStorageStats::Get(context, graph_info, vertex_info).bytes;
+    }
+    for (const auto& edge_info : graph_info->GetEdgeInfos()) {
+        result.bytes += TableStorageStats::Get(context, graph_info, edge_info).bytes;
+    }
+    // the graph is not stored in blocks of DuckDB
+    result.block_size = 0;
+    result.total_blocks = 0;
+    result.used_blocks = 0;
+    result.free_blocks = 0;
+    result.wal_size = 0;
+    return result;
 }
 
 }  // namespace duckdb
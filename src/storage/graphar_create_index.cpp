@@ -0,0 +1,42 @@
+#include "storage/graphar_create_index.hpp"
+
+#include "storage/graphar_catalog.hpp"
+#include "storage/graphar_table_entry.hpp"
+#include "storage/graphar_table_information.hpp"
+#include "storage/graphar_transaction.hpp"
+#include "utils/global_log_manager.hpp"
+#include "utils/vertex_key_index.hpp"
+
+#include <duckdb/execution/physical_plan_generator.hpp>
+
+namespace duckdb {
+
+LogicalGraphArCreateIndex::LogicalGraphArCreateIndex(GraphArTableEntry& table, std::string property)
+    : table(table), property(std::move(property)) {}
+
+PhysicalOperator& LogicalGraphArCreateIndex::CreatePlan(ClientContext& context, PhysicalPlanGenerator& planner) {
+    return planner.Make<GraphArCreateIndex>(*this, table, property);
+}
+
+GraphArCreateIndex::GraphArCreateIndex(PhysicalPlan& physical_plan, LogicalOperator& op, GraphArTableEntry& table,
+                                       std::string property)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::EXTENSION, op.types, 1),
+      table(table),
+      property(std::move(property)) {}
+//-------------------------------------------------------------------
+// Source
+//-------------------------------------------------------------------
+SourceResultType GraphArCreateIndex::GetData(ExecutionContext& context, DataChunk& chunk,
+                                             OperatorSourceInput& input) const {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArCreateIndex::GetData");
+    auto table_info = table.GetTableInfo();
+    const auto& graph_info = table_info->GetCatalog().GetGraphInfo();
+    // written to the staging directory of the transaction, which holds the writer slot, and moved into the graph on
+    // commit, so that a rollback drops the index
+    auto& transaction = GraphArTransaction::Get(context.client, table.catalog);
+    VertexKeyIndex::Build(context.client, graph_info, table_info->GetParams()[0], property,
+                          transaction.GetStagingPrefix());
+    return SourceResultType::FINISHED;
+}
+
+}  // namespace duckdb
@@ -0,0 +1,292 @@
+#include "storage/graphar_insert.hpp"
+
+#include "storage/graphar_catalog.hpp"
+#include "storage/graphar_table_entry.hpp"
+#include "storage/graphar_table_information.hpp"
+#include "storage/graphar_transaction.hpp"
+#include "utils/edge_delta.hpp"
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <arrow/c/bridge.h>
+
+#include <duckdb/common/arrow/arrow_converter.hpp>
+#include <duckdb/common/arrow/arrow_type_extension.hpp>
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/common/types/column/column_data_collection.hpp>
+#include <duckdb/main/client_context.hpp>
+
+#include <graphar/arrow/chunk_writer.h>
+#include <graphar/filesystem.h>
+
+namespace duckdb {
+
+GraphArInsert::GraphArInsert(PhysicalPlan& physical_plan, LogicalOperator& op, GraphArTableEntry& table,
+                             physical_index_vector_t<idx_t> column_index_map)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::EXTENSION, op.types, 1),
+      table(table),
+      column_index_map(std::move(column_index_map)) {}
+//-------------------------------------------------------------------
+// States
+//-------------------------------------------------------------------
+class GraphArInsertGlobalState : public GlobalSinkState {
+public:
+    GraphArInsertGlobalState(ClientContext& context, const vector<LogicalType>& types)
+        : rows(context, types), insert_count(0) {}
+
+    ColumnDataCollection rows;
+    idx_t insert_count;
+};
+
+// What an insert writes, with its rows in the column order of the table
+struct GraphArInsertTarget {
+    GraphArInsertTarget(ClientContext& context, const GraphArInsert& op)
+        : context(context), op(op), transaction(GraphArTransaction::Get(context, op.table.catalog)) {
+        // takes the writer lock before the vertex and delta counts the insert continues from are read
+        transaction.GetStagingPrefix();
+        auto table_info = op.table.GetTableInfo();
+        type = table_info->GetType();
+        params = table_info->GetParams();
+        graph_info = table_info->GetCatalog().GetGraphInfo();
+        for (auto& column : op.table.GetColumns().Physical()) {
+            names.push_back(column.Name());
+            types.push_back(column.Type());
+        }
+        // vertex ids are positions, they are not stored as a property
+        first_column = type == GraphArTableType::Vertex ? 1 : 0;
+        ArrowSchema arrow_schema;
+        auto properties = context.GetClientProperties();
+        ArrowConverter::ToArrowSchema(&arrow_schema, vector<LogicalType>(types.begin() + first_column, types.end()),
+                                      vector<string>(names.begin() + first_column, names.end()), properties);
+        auto maybe_schema = arrow::ImportSchema(&arrow_schema);
+        if (!maybe_schema.ok()) {
+            throw IOException("Failed to import Arrow schema: " + maybe_schema.status().message());
+        }
+        schema = maybe_schema.ValueUnsafe();
+        std::string out_prefix;
+        GAR_ASSIGN_OR_RAISE_ERROR(fs, graphar::FileSystemFromUriOrPath(graph_info->GetPrefix(), &out_prefix));
+    }
+
+    ClientContext& context;
+    const GraphArInsert& op;
+    GraphArTransaction& transaction;
+    GraphArTableType type;
+    vector<std::string> params;
+    std::shared_ptr<graphar::GraphInfo> graph_info;
+    vector<std::string> names;
+    vector<LogicalType> types;
+    idx_t first_column;
+    std::shared_ptr<arrow::Schema> schema;
+    std::shared_ptr<graphar::FileSystem> fs;
+};
+
+unique_ptr<GlobalSinkState> GraphArInsert::GetGlobalSinkState(ClientContext& context) const {
+    return make_uniq<GraphArInsertGlobalState>(context, children[0].get().GetTypes());
+}
+//-------------------------------------------------------------------
+// Files
+//-------------------------------------------------------------------
+static int64_t ReadCount(GraphArInsertTarget& target, const std::string& relative_path) {
+    return ReadCount(FileSystem::GetFileSystem(target.context), target.transaction.GetFilePath(relative_path), 0);
+}
+
+static std::shared_ptr<arrow::Table> ReadFile(GraphArInsertTarget& target, const std::string& relative_path,
+                                              graphar::FileType file_type) {
+    GAR_ASSIGN_OR_RAISE_ERROR(auto table,
+                              target.fs->ReadFileToTable(target.transaction.GetFilePath(relative_path), file_type));
+    return table;
+}
+
+static std::shared_ptr<arrow::Table> Concatenate(const vector<std::shared_ptr<arrow::Table>>& tables) {
+    auto maybe_table = arrow::ConcatenateTables(tables);
+    if (!maybe_table.ok()) {
+        throw IOException("Failed to append rows: " + maybe_table.status().message());
+    }
+    return maybe_table.ValueUnsafe();
+}
+
+static std::shared_ptr<arrow::Table> BatchesToTable(const GraphArInsertTarget& target,
+                                                    const vector<std::shared_ptr<arrow::RecordBatch>>& batches) {
+    auto maybe_table = arrow::Table::FromRecordBatches(target.schema, batches);
+    if (!maybe_table.ok()) {
+        throw IOException("Failed to build inserted rows: " + maybe_table.status().message());
+    }
+    return maybe_table.ValueUnsafe();
+}
+//-------------------------------------------------------------------
+// Rows
+//-------------------------------------------------------------------
+// Input column of a table column; without a column list the input has every column of the table
+static idx_t GetInputIndex(const GraphArInsertTarget& target, idx_t column) {
+    if (target.op.column_index_map.empty()) {
+        return column;
+    }
+    return target.op.column_index_map[PhysicalIndex(column)];
+}
+
+// Puts the inserted columns in the order of the table; columns left out of the insert are NULL
+static void ToTableChunk(const GraphArInsertTarget& target, DataChunk& input, DataChunk& result) {
+    result.InitializeEmpty(target.types);
+    for (idx_t i = 0; i < target.types.size(); ++i) {
+        const auto input_index = GetInputIndex(target, i);
+        if (input_index == DConstants::INVALID_INDEX) {
+            result.data[i].Reference(Value(target.types[i]));
+        } else {
+            result.data[i].Reference(input.data[input_index]);
+        }
+    }
+    result.SetCardinality(input.size());
+}
+
+static std::shared_ptr<arrow::RecordBatch> ToRecordBatch(const GraphArInsertTarget& target, DataChunk& chunk) {
+    DataChunk properties;
+    properties.InitializeEmpty(vector<LogicalType>(target.types.begin() + target.first_column, target.types.end()));
+    for (idx_t i = target.first_column; i < chunk.ColumnCount(); ++i) {
+        properties.data[i - target.first_column].Reference(chunk.data[i]);
+    }
+    properties.SetCardinality(chunk.size());
+    ArrowArray array;
+    ArrowConverter::ToArrowArray(properties, &array, target.context.GetClientProperties(),
+                                 ArrowTypeExtensionData::GetExtensionTypes(target.context, properties.GetTypes()));
+    auto maybe_batch = arrow::ImportRecordBatch(&array, target.schema);
+    if (!maybe_batch.ok()) {
+        throw IOException("Failed to convert rows to Arrow: " + maybe_batch.status().message());
+    }
+    return maybe_batch.ValueUnsafe();
+}
+//-------------------------------------------------------------------
+// Vertices
+//-------------------------------------------------------------------
+static std::shared_ptr<arrow::Table> ReadVertexChunk(GraphArInsertTarget& target,
+                                                     const std::shared_ptr<graphar::VertexInfo>& vertex_info,
+                                                     graphar::IdType chunk_index) {
+    vector<std::shared_ptr<arrow::Table>> tables;
+    for (const auto& pg : vertex_info->GetPropertyGroups()) {
+        GAR_ASSIGN_OR_RAISE_ERROR(auto path, vertex_info->GetFilePath(pg, chunk_index));
+        tables.push_back(ReadFile(target, path, pg->GetFileType()));
+    }
+    return AssembleTable(target.schema, tables);
+}
+
+// New vertices continue the last chunk, which is rewritten when it is not full
+static void InsertVertices(GraphArInsertTarget& target, ColumnDataCollection& rows) {
+    auto vertex_info = target.graph_info->GetVertexInfo(target.params[0]);
+    GAR_ASSIGN_OR_RAISE_ERROR(auto count_path, vertex_info->GetVerticesNumFilePath());
+    const auto vertex_num = ReadCount(target, count_path);
+    const auto chunk_size = vertex_info->GetChunkSize();
+
+    vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    const bool has_ids = GetInputIndex(target, 0) != DConstants::INVALID_INDEX;
+    int64_t next_id = vertex_num;
+    for (auto& input : rows.Chunks()) {
+        DataChunk chunk;
+        ToTableChunk(target, input, chunk);
+        if (has_ids) {
+            UnifiedVectorFormat ids;
+            chunk.data[0].ToUnifiedFormat(chunk.size(), ids);
+            const auto id_data = UnifiedVectorFormat::GetData<int64_t>(ids);
+            for (idx_t row = 0; row < chunk.size(); ++row) {
+                const auto idx = ids.sel->get_index(row);
+                if (ids.validity.RowIsValid(idx) && id_data[idx] != next_id + static_cast<int64_t>(row)) {
+                    throw ConstraintException("Vertex %s must be NULL or the next id %lld, got %lld", target.names[0],
+                                              next_id + static_cast<int64_t>(row), id_data[idx]);
+                }
+            }
+        }
+        next_id += chunk.size();
+        batches.push_back(ToRecordBatch(target, chunk));
+    }
+
+    auto table = BatchesToTable(target, batches);
+    const auto start_chunk = vertex_num / chunk_size;
+    const auto rest = vertex_num % chunk_size;
+    if (rest > 0) {
+        table = Concatenate({ReadVertexChunk(target, vertex_info, start_chunk)->Slice(0, rest), table});
+    }
+    GAR_ASSIGN_OR_RAISE_ERROR(auto writer, graphar::VertexPropertyWriter::Make(
+                                               vertex_info, target.transaction.GetStagingPrefix()));
+    CheckWriteStatus(writer->WriteTable(table, start_chunk), "vertex chunks of " + target.params[0]);
+    CheckWriteStatus(writer->WriteVerticesNum(next_id), "vertex count of " + target.params[0]);
+    DUCKDB_GRAPHAR_LOG_DEBUG("Staged " + std::to_string(next_id - vertex_num) + " vertices of " + target.params[0]);
+}
+//-------------------------------------------------------------------
+// Edges
+//-------------------------------------------------------------------
+static int64_t GetVertexNum(GraphArInsertTarget& target, const std::string& type) {
+    GAR_ASSIGN_OR_RAISE_ERROR(auto count_path, target.graph_info->GetVertexInfo(type)->GetVerticesNumFilePath());
+    return ReadCount(target, count_path);
+}
+
+// New edges are written unsorted as the next delta chunk of the edge type, which keeps inserts cheap; scans read the
+// delta chunks next to the sorted adjacency lists until a checkpoint merges them
+static void InsertEdges(GraphArInsertTarget& target, ColumnDataCollection& rows) {
+    auto edge_info = target.graph_info->GetEdgeInfo(target.params[0], target.params[1], target.params[2]);
+    const int64_t vertex_nums[] = {GetVertexNum(target, target.params[0]), GetVertexNum(target, target.params[2])};
+
+    vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    for (auto& input : rows.Chunks()) {
+        DataChunk chunk;
+        ToTableChunk(target, input, chunk);
+        for (idx_t side = 0; side < 2; ++side) {
+            UnifiedVectorFormat ids;
+            chunk.data[side].ToUnifiedFormat(chunk.size(), ids);
+            const auto id_data = UnifiedVectorFormat::GetData<int64_t>(ids);
+            for (idx_t row = 0; row < chunk.size(); ++row) {
+                const auto idx = ids.sel->get_index(row);
+                if (!ids.validity.RowIsValid(idx)) {
+                    throw ConstraintException("Edge %s must not be NULL", target.names[side]);
+                }
+                if (id_data[idx] < 0 || id_data[idx] >= vertex_nums[side]) {
+                    throw ConstraintException("Edge %s %lld is not a vertex id", target.names[side], id_data[idx]);
+                }
+            }
+        }
+        batches.push_back(ToRecordBatch(target, chunk));
+    }
+
+    const auto delta_chunk = ReadCount(target, EdgeDelta::GetCountPath(*edge_info));
+    const auto& staging_prefix = target.transaction.GetStagingPrefix();
+    EdgeDelta::WriteChunk(FileSystem::GetFileSystem(target.context), BatchesToTable(target, batches),
+                          staging_prefix + EdgeDelta::GetChunkPath(*edge_info, delta_chunk));
+    CheckWriteStatus(target.fs->WriteValueToFile<graphar::IdType>(delta_chunk + 1,
+                                                                  staging_prefix + EdgeDelta::GetCountPath(*edge_info)),
+                     "delta count of " + target.params[1]);
+    DUCKDB_GRAPHAR_LOG_DEBUG("Staged " + std::to_string(rows.Count()) + " edges of " + target.params[1] +
+                             " as delta chunk " + std::to_string(delta_chunk));
+}
+//-------------------------------------------------------------------
+// Sink
+//-------------------------------------------------------------------
+SinkResultType GraphArInsert::Sink(ExecutionContext& context, DataChunk& chunk, OperatorSinkInput& input) const {
+    auto& gstate = input.global_state.Cast<GraphArInsertGlobalState>();
+    gstate.rows.Append(chunk);
+    return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkFinalizeType GraphArInsert::Finalize(Pipeline& pipeline, Event& event, ClientContext& context,
+                                         OperatorSinkFinalizeInput& input) const {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArInsert::Finalize");
+    auto& gstate = input.global_state.Cast<GraphArInsertGlobalState>();
+    gstate.insert_count = gstate.rows.Count();
+    if (gstate.insert_count == 0) {
+        return SinkFinalizeType::READY;
+    }
+    GraphArInsertTarget target(context, *this);
+    if (target.type == GraphArTableType::Vertex) {
+        InsertVertices(target, gstate.rows);
+    } else {
+        InsertEdges(target, gstate.rows);
+    }
+    return SinkFinalizeType::READY;
+}
+//-------------------------------------------------------------------
+// Source
+//-------------------------------------------------------------------
+SourceResultType GraphArInsert::GetData(ExecutionContext& context, DataChunk& chunk, OperatorSourceInput& input) const {
+    auto& gstate = sink_state->Cast<GraphArInsertGlobalState>();
+    chunk.SetCardinality(1);
+    chunk.SetValue(0, 0, Value::BIGINT(gstate.insert_count));
+    return SourceResultType::FINISHED;
+}
+
+}  // namespace duckdb
@@ -6,7 +6,9 @@
 #include "utils/global_log_manager.hpp"
 
 #include <duckdb/catalog/catalog_entry/schema_catalog_entry.hpp>
+#include <duckdb/catalog/catalog_search_path.hpp>
 #include <duckdb/catalog/catalog_entry/table_catalog_entry.hpp>
+#include <duckdb/common/string_util.hpp>
 #include <duckdb/main/client_data.hpp>
 #include <duckdb/parser/parsed_data/attach_info.hpp>
 #include <duckdb/parser/parsed_data/create_schema_info.hpp>
@@ -17,6 +19,26 @@
 
 namespace duckdb {
 
+// Unqualified names of the attaching connection also find the tables of the graph, after everything they found
+// before; its default database and the search paths of the other connections stay as they are. The entry is removed
+// when the same connection detaches the graph (GraphArCatalog::OnDetach); one left behind by a detach from another
+// connection is reused when the name is attached again.
+static void AppendToSearchPath(ClientContext& context, const string& name) {
+    auto& search_path = *ClientData::Get(context).catalog_search_path;
+    auto paths = search_path.GetSetPaths();
+    for (const auto& path : paths) {
+        if (StringUtil::CIEquals(path.catalog, name) && path.schema == DEFAULT_SCHEMA) {
+            return;
+        }
+    }
+    if (paths.empty()) {
+        paths.push_back(search_path.GetDefault());
+    }
+    paths.emplace_back(name, DEFAULT_SCHEMA);
+    // the catalog is not registered yet, so the path cannot be verified
+    search_path.Set(std::move(paths), CatalogSetPathType::SET_DIRECTLY);
+}
+
 static unique_ptr<Catalog> GraphArAttach(optional_ptr<StorageExtensionInfo> storage_info, ClientContext& context,
                                          AttachedDatabase& db, const string& name, AttachInfo& info,
                                          AttachOptions& attach_options) {
@@ -30,7 +52,8 @@ static unique_ptr<Catalog> GraphArAttach(optional_ptr<StorageExtensionInfo> stor
         throw IOException(
             "Using relative path as prefix is not supported. Please use absolute path or just remove this field.");
     }
-    return make_uniq<GraphArCatalog>(db, info.path, graph_info, context, db.name);
+    AppendToSearchPath(context, db.name);
+    return make_uniq<GraphArCatalog>(db, info.path, graph_info, db.name);
 }
 
 static unique_ptr<TransactionManager> GraphArCreateTransactionManager(optional_ptr<StorageExtensionInfo> storage_info,
@@ -5,6 +5,7 @@
 #include "storage/graphar_table_information.hpp"
 #include "utils/func.hpp"
 #include "utils/global_log_manager.hpp"
+#include "utils/table_storage_stats.hpp"
 
 #include <duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp>
 #include <duckdb/common/multi_file/multi_file_reader.hpp>
@@ -20,8 +21,8 @@
 
 namespace duckdb {
 
-GraphArTableEntry::GraphArTableEntry(Catalog& catalog, unique_ptr<SchemaCatalogEntry> schema, CreateTableInfo& info)
-    : TableCatalogEntry(catalog, *schema, info), schema(std::move(schema)) {}
+GraphArTableEntry::GraphArTableEntry(Catalog& catalog, SchemaCatalogEntry& schema, CreateTableInfo& info)
+    : TableCatalogEntry(catalog, schema, info) {}
 
 unique_ptr<BaseStatistics> GraphArTableEntry::GetStatistics(ClientContext& context, column_t column_id) {
     // DUCKDB_GRAPHAR_LOG_TRACE("GraphArTableEntry::GetStatistics");
@@ -57,23 +58,18 @@ TableFunction GraphArTableEntry::GetScanFunction(ClientContext& context, unique_
 TableFunction GraphArTableEntry::GetScanFunction(ClientContext& context, unique_ptr<FunctionData>& bind_data,
                                                  const EntryLookupInfo& lookup) {
     DUCKDB_GRAPHAR_LOG_TRACE("GraphArTableEntry::GetScanFunction");
-    auto bind_data_ = make_uniq<ReadBindData>();
     auto tmp_table_info = table_info.lock();
+    // the bind data computed with the entry only needs a copy; just the delta chunks and edge count of edges change
+    // between scans
+    auto scan_bind_data = make_uniq<ReadBindData>(tmp_table_info->GetBindData());
     switch (tmp_table_info->GetType()) {
         case GraphArTableType::Vertex:
-            ReadVertices::SetBindData(
-                tmp_table_info->GetCatalog().GetGraphInfo(),
-                *tmp_table_info->GetCatalog().GetGraphInfo()->GetVertexInfo(tmp_table_info->GetParams()[0]),
-                bind_data_);
-            bind_data = std::move(bind_data_);
+            bind_data = std::move(scan_bind_data);
             return ReadVertices::GetScanFunction();
         case GraphArTableType::Edge:
-            ReadEdges::SetBindData(
-                tmp_table_info->GetCatalog().GetGraphInfo(),
-                *tmp_table_info->GetCatalog().GetGraphInfo()->GetEdgeInfo(
-                    tmp_table_info->GetParams()[0], tmp_table_info->GetParams()[1], tmp_table_info->GetParams()[2]),
-                bind_data_);
-            bind_data = std::move(bind_data_);
+            ReadEdges::SetDeltaChunkNum(context, *scan_bind_data);
+            ReadEdges::SetEdgeCount(context, *scan_bind_data);
+            bind_data = std::move(scan_bind_data);
             return ReadEdges::GetScanFunction();
         default:
             throw InternalException("Unknown table type");
@@ -81,8 +77,23 @@ TableFunction GraphArTableEntry::GetScanFunction(ClientContext& context, unique_
 }
 
 TableStorageInfo GraphArTableEntry::GetStorageInfo(ClientContext& context) {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArTableEntry::GetStorageInfo");
+    auto tmp_table_info = table_info.lock();
+    const auto& graph_info = tmp_table_info->GetCatalog().GetGraphInfo();
+    const auto& params = tmp_table_info->GetParams();
     TableStorageInfo result;
-    // TODO fill info
+    switch (tmp_table_info->GetType()) {
+        case GraphArTableType::Vertex:
+            result.cardinality = TableStorageStats::Get(context, graph_info, graph_info->GetVertexInfo(params[0])).rows;
+            break;
+        case GraphArTableType::Edge:
+            result.cardinality =
+                TableStorageStats::Get(context, graph_info, graph_info->GetEdgeInfo(params[0], params[1], params[2]))
+                    .rows;
+            break;
+        default:
+            throw InternalException("Unknown table type");
+    }
     return result;
 }
 
@@ -8,28 +8,55 @@
 #include "storage/graphar_transaction.hpp"
 #include "utils/func.hpp"
 
+#include <duckdb/catalog/catalog.hpp>
 #include <duckdb/catalog/dependency_list.hpp>
+#include <duckdb/common/string_util.hpp>
 #include <duckdb/common/types.hpp>
+#include <duckdb/common/types/hash.hpp>
 #include <duckdb/parser/constraints/list.hpp>
 #include <duckdb/parser/constraints/not_null_constraint.hpp>
 #include <duckdb/parser/constraints/unique_constraint.hpp>
 #include <duckdb/parser/expression/constant_expression.hpp>
-#include <duckdb/parser/parsed_data/create_schema_info.hpp>
+#include <duckdb/parser/keyword_helper.hpp>
 #include <duckdb/parser/parsed_data/create_table_info.hpp>
 #include <duckdb/parser/parsed_data/drop_info.hpp>
 #include <duckdb/parser/parser.hpp>
+#include <duckdb/parser/statement/select_statement.hpp>
 #include <duckdb/planner/parsed_data/bound_create_table_info.hpp>
 
 #include <filesystem>
 
 namespace duckdb {
 
-void GraphArTableSet::FillEntry(ClientContext& context, GraphArTableInformation& table) {
+// Builds the catalog entry of a table on its first lookup, with the columns of the property groups of its type
+void GraphArTableSet::FillEntry(ClientContext& context, const shared_ptr<GraphArTableInformation>& table) {
     DUCKDB_GRAPHAR_LOG_TRACE("GraphArTableSet::FillEntry");
-    if (table.IsFilled()) {
+    if (table->IsFilled()) {
         return;
     }
-    // Does nothing as for now, but can be useful in future
+    auto& graphar_catalog = catalog.Cast<GraphArCatalog>();
+    const auto& graph_info = graphar_catalog.GetGraphInfo();
+    const auto& params = table->GetParams();
+    auto bind_data = make_uniq<ReadBindData>();
+    if (table->GetType() == GraphArTableType::Vertex) {
+        ReadVertices::SetBindData(graph_info, *graph_info->GetVertexInfo(params[0]), bind_data);
+    } else {
+        ReadEdges::SetBindData(graph_info, *graph_info->GetEdgeInfo(params[0], params[1], params[2]), bind_data);
+    }
+
+    CreateTableInfo type_info;
+    type_info.table = table->GetName();
+    vector<ColumnDefinition> columns;
+    for (idx_t i = 0; i < bind_data->GetFlattenPropNames().size(); ++i) {
+        columns.emplace_back(bind_data->GetFlattenPropNames()[i],
+                             GraphArFunctions::graphArT2duckT(bind_data->GetFlattenPropTypes()[i]));
+    }
+    type_info.columns = ColumnList(std::move(columns));
+
+    table->SetBindData(shared_ptr<const ReadBindData>(std::move(bind_data)));
+    table->SetEntry(make_uniq<GraphArTableEntry>(catalog, schema, type_info));
+    table->GetEntry().SetTableInfo(table);
+    DUCKDB_GRAPHAR_LOG_INFO("Table was created with name " + table->GetName());
 }
 
 void GraphArTableSet::Scan(ClientContext& context, const std::function<void(CatalogEntry&)>& callback) {
@@ -37,9 +64,8 @@ void GraphArTableSet::Scan(ClientContext& context, const std::function<void(Cata
     lock_guard<mutex> l(entry_lock);
     LoadEntries(context);
     for (auto& entry : table_entries) {
-        auto& table_info = entry.second;
-        FillEntry(context, *table_info);
-        callback(table_info->GetEntry());
+        FillEntry(context, entry.second);
+        callback(entry.second->GetEntry());
     }
     for (auto& entry : view_entries) {
         callback(static_cast<CatalogEntry&>(*entry.second));
@@ -54,11 +80,13 @@ optional_ptr<CatalogEntry> GraphArTableSet::CreateNewEntry(ClientContext& contex
 optional_ptr<CatalogEntry> GraphArTableSet::CreateNewEntry(ClientContext& context, Catalog& catalog,
                                                            GraphArSchemaEntry& schema, CreateViewInfo& info) {
     auto view = make_shared_ptr<ViewCatalogEntry>(catalog, schema, info);
+    lock_guard<mutex> l(entry_lock);
     view_entries[info.view_name] = view;
     DUCKDB_GRAPHAR_LOG_INFO("View was created with name " + info.view_name)
     return view.get();
 }
 
+// Only registers the names of the tables, their entries are built by FillEntry
 template <typename InfoVector>
 std::enable_if_t<
     std::is_same_v<InfoVector, graphar::VertexInfoVector> || std::is_same_v<InfoVector, graphar::EdgeInfoVector>, void>
@@ -66,33 +94,15 @@ GraphArTableSet::CreateTables(GraphArCatalog& graphar_catalog, const InfoVector&
     DUCKDB_GRAPHAR_LOG_TRACE("GraphArTableSet::CreateTables");
 
     for (auto& info : infos) {
-        auto type_info = make_uniq<CreateTableInfo>();
         auto file_name = GraphArFunctions::GetNameFromInfo(info);
-        type_info->table = file_name;
-
-        auto bind_data = make_uniq<ReadBindData>();
-        auto& graphar_catalog = catalog.Cast<GraphArCatalog>();
+        vector<string> params;
         if constexpr (std::is_same_v<InfoVector, graphar::VertexInfoVector>) {
-            ReadVertices::SetBindData(graphar_catalog.GetGraphInfo(), *info, bind_data);
+            params = {info->GetType()};
         } else {
-            ReadEdges::SetBindData(graphar_catalog.GetGraphInfo(), *info, bind_data);
-        }
-
-        vector<ColumnDefinition> columns;
-        for (idx_t i = 0; i < bind_data->GetFlattenPropNames().size(); ++i) {
-            columns.emplace_back(bind_data->GetFlattenPropNames()[i],
-                                 GraphArFunctions::graphArT2duckT(bind_data->GetFlattenPropTypes()[i]));
+            params = {info->GetSrcType(), info->GetEdgeType(), info->GetDstType()};
         }
-        type_info->columns = ColumnList(std::move(columns));
-
-        CreateSchemaInfo fake_schema_info;
-        auto schema = make_uniq<GraphArSchemaEntry>(catalog, fake_schema_info);
-        auto table_entry = make_uniq<GraphArTableEntry>(catalog, std::move(schema), *type_info);
-        auto table_info = make_shared_ptr<GraphArTableInformation>(graphar_catalog, std::move(table_entry), file_name,
-                                                                   type, bind_data->GetParams());
-        table_info->GetEntry().SetTableInfo(table_info);
-        table_entries[file_name] = std::move(table_info);
-        DUCKDB_GRAPHAR_LOG_INFO("Table was created with name " + file_name);
+        table_entries[file_name] =
+            make_shared_ptr<GraphArTableInformation>(graphar_catalog, file_name, type, std::move(params));
     }
 }
 
@@ -118,22 +128,72 @@ unique_ptr<GraphArTableInformation> GraphArTableSet::GetTableInfo(ClientContext&
 optional_ptr<CatalogEntry> GraphArTableSet::GetEntry(ClientContext& context, const EntryLookupInfo& lookup) {
     const auto& entry_name = lookup.GetEntryName();
     DUCKDB_GRAPHAR_LOG_TRACE("GraphArTableSet::GetEntry " + entry_name);
-    LoadEntries(context);
     lock_guard<mutex> l(entry_lock);
+    LoadEntries(context);
     {
         auto entry = table_entries.find(entry_name);
         if (entry != table_entries.end()) {
-            FillEntry(context, *entry->second);
+            FillEntry(context, entry->second);
             return entry->second->GetEntry();
         }
     }
     {
         auto entry = view_entries.find(entry_name);
         if (entry != view_entries.end()) {
-            return entry->second.get();
+            auto materialized = GetMaterializedEntry(context, *entry->second);
+            return materialized ? materialized : entry->second.get();
         }
     }
     return nullptr;
 }
 
+shared_ptr<ViewCatalogEntry> GraphArTableSet::GetView(const string& name) {
+    lock_guard<mutex> l(entry_lock);
+    auto entry = view_entries.find(name);
+    return entry == view_entries.end() ? nullptr : entry->second;
+}
+
+// The fingerprint covers the query of the view too, so a replaced view does not read the rows of the old one
+string GraphArTableSet::GetMaterializedName(const ViewCatalogEntry& view, hash_t fingerprint) {
+    const auto query = view.query->ToString();
+    char suffix[17];
+    snprintf(suffix, sizeof(suffix), "%016llx",
+             static_cast<unsigned long long>(CombineHash(fingerprint, Hash(query.c_str(), query.size()))));
+    return view.name + "__" + suffix;
+}
+
+bool GraphArTableSet::IsMaterializedName(const string& name, const string& view_name) {
+    return name.size() == view_name.size() + 18 && StringUtil::CIEquals(name.substr(0, view_name.size()), view_name) &&
+           name.substr(view_name.size(), 2) == "__";
+}
+
+// A view reads the table graphar_materialize wrote its rows to while the cache database is attached and the graph
+// files are unchanged since, and runs its query again otherwise
+optional_ptr<CatalogEntry> GraphArTableSet::GetMaterializedEntry(ClientContext& context, const ViewCatalogEntry& view) {
+    auto& graphar_catalog = catalog.Cast<GraphArCatalog>();
+    auto cache = Catalog::GetCatalogEntry(context, graphar_catalog.GetCacheName());
+    if (!cache) {
+        return nullptr;
+    }
+    const auto fingerprint = GetGraphFingerprint(context, graphar_catalog.GetGraphInfo());
+    const auto name = GetMaterializedName(view, fingerprint);
+    if (!cache->GetEntry<TableCatalogEntry>(context, DEFAULT_SCHEMA, name, OnEntryNotFound::RETURN_NULL)) {
+        DUCKDB_GRAPHAR_LOG_DEBUG("View " + view.name + " is not materialized for the current graph files");
+        return nullptr;
+    }
+    auto& entry = materialized_entries[name];
+    if (!entry) {
+        CreateViewInfo info(catalog.GetName(), schema.name, view.name);
+        Parser parser;
+        parser.ParseQuery("SELECT * FROM " + KeywordHelper::WriteOptionallyQuoted(cache->GetName()) + "." +
+                          DEFAULT_SCHEMA + "." + KeywordHelper::WriteOptionallyQuoted(name));
+        info.query = unique_ptr_cast<SQLStatement, SelectStatement>(std::move(parser.statements[0]));
+        info.aliases = view.aliases;
+        info.types = view.types;
+        info.names = view.names;
+        entry = make_shared_ptr<ViewCatalogEntry>(catalog, schema, info);
+    }
+    return entry.get();
+}
+
 }  // namespace duckdb
@@ -7,6 +7,9 @@
 
 #include <duckdb/catalog/catalog_entry/index_catalog_entry.hpp>
 #include <duckdb/catalog/catalog_entry/view_catalog_entry.hpp>
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/common/string_util.hpp>
+#include <duckdb/common/types/uuid.hpp>
 #include <duckdb/parser/expression/columnref_expression.hpp>
 #include <duckdb/parser/parsed_data/create_table_info.hpp>
 #include <duckdb/parser/parsed_data/create_view_info.hpp>
@@ -14,6 +17,7 @@
 #include <duckdb/parser/parser.hpp>
 #include <duckdb/parser/statement/create_statement.hpp>
 
+#include <filesystem>
 #include <iostream>
 
 namespace duckdb {
@@ -22,11 +26,145 @@ GraphArTransaction::GraphArTransaction(GraphArCatalog& graphar_catalog, Transact
                                        ClientContext& context)
     : Transaction(manager, context), graphar_catalog(graphar_catalog), db(*context.db) {}
 
-GraphArTransaction::~GraphArTransaction() = default;
+GraphArTransaction::~GraphArTransaction() { graphar_catalog.UnlockWriter(*this); }
 
 void GraphArTransaction::Start() { DUCKDB_GRAPHAR_LOG_TRACE("GraphArTransaction::Start"); }
-void GraphArTransaction::Commit() { DUCKDB_GRAPHAR_LOG_TRACE("GraphArTransaction::Commit"); }
-void GraphArTransaction::Rollback() { throw NotImplementedException("GraphArTransaction::Rollback"); }
+
+// Count files tell readers how many vertices and edges there are, so they are replaced after the chunks they count
+static bool IsCountFile(const std::filesystem::path& path) {
+    const auto name = path.filename().string();
+    return StringUtil::StartsWith(name, "vertex_count") || StringUtil::StartsWith(name, "edge_count") ||
+           name == "delta_count";
+}
+
+// A graph file replaced or removed by a commit, and where its old version is kept until the commit is done
+struct GraphArCommitUndo {
+    std::filesystem::path target;
+    std::filesystem::path backup;
+};
+
+// Keeps the current version of a graph file in the backup directory. Files that are replaced are linked rather than
+// moved, so the rename of the staged file over them stays atomic for readers.
+static void Backup(const std::filesystem::path& target, const std::filesystem::path& backup, bool keep_target) {
+    std::filesystem::create_directories(backup.parent_path());
+    if (!keep_target) {
+        std::filesystem::rename(target, backup);
+        return;
+    }
+    std::error_code error;
+    std::filesystem::create_hard_link(target, backup, error);
+    if (error) {
+        std::filesystem::copy_file(target, backup);
+    }
+}
+
+static void Undo(const std::vector<GraphArCommitUndo>& undo_log) {
+    for (auto it = undo_log.rbegin(); it != undo_log.rend(); ++it) {
+        std::error_code error;
+        if (it->backup.empty()) {
+            std::filesystem::remove(it->target, error);
+        } else {
+            std::filesystem::rename(it->backup, it->target, error);
+        }
+        if (error) {
+            DUCKDB_GRAPHAR_LOG_ERROR("Failed to restore " + it->target.string() + ": " + error.message());
+        }
+    }
+}
+
+void GraphArTransaction::MoveStagedFiles() {
+    std::vector<std::filesystem::path> data_files;
+    std::vector<std::filesystem::path> count_files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(staging_prefix)) {
+        if (entry.is_regular_file()) {
+            (IsCountFile(entry.path()) ? count_files : data_files).push_back(entry.path());
+        }
+    }
+    data_files.insert(data_files.end(), count_files.begin(), count_files.end());
+    const std::filesystem::path prefix = graphar_catalog.GetGraphInfo()->GetPrefix();
+    const std::filesystem::path backup_prefix = staging_prefix.substr(0, staging_prefix.size() - 1) + ".backup";
+    std::vector<GraphArCommitUndo> undo_log;
+    try {
+        for (const auto& file : data_files) {
+            const auto relative_path = std::filesystem::relative(file, staging_prefix);
+            GraphArCommitUndo undo{prefix / relative_path, {}};
+            if (std::filesystem::exists(undo.target)) {
+                undo.backup = backup_prefix / relative_path;
+                Backup(undo.target, undo.backup, true);
+            }
+            undo_log.push_back(undo);
+            std::filesystem::create_directories(undo.target.parent_path());
+            std::filesystem::rename(file, undo.target);
+        }
+        for (const auto& path : removed_paths) {
+            GraphArCommitUndo undo{prefix / path, backup_prefix / path};
+            if (std::filesystem::exists(undo.target)) {
+                Backup(undo.target, undo.backup, false);
+                undo_log.push_back(undo);
+            }
+        }
+    } catch (...) {
+        Undo(undo_log);
+        std::filesystem::remove_all(backup_prefix);
+        throw;
+    }
+    std::filesystem::remove_all(backup_prefix);
+    DUCKDB_GRAPHAR_LOG_DEBUG("Committed " + std::to_string(data_files.size()) + " files");
+}
+
+void GraphArTransaction::EndWrite() {
+    if (!staging_prefix.empty()) {
+        std::error_code error;
+        std::filesystem::remove_all(staging_prefix, error);
+        staging_prefix.clear();
+    }
+    removed_paths.clear();
+    graphar_catalog.UnlockWriter(*this);
+}
+
+void GraphArTransaction::Commit() {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArTransaction::Commit");
+    if (staging_prefix.empty()) {
+        return;
+    }
+    try {
+        MoveStagedFiles();
+    } catch (...) {
+        EndWrite();
+        throw;
+    }
+    EndWrite();
+}
+
+void GraphArTransaction::Rollback() {
+    DUCKDB_GRAPHAR_LOG_TRACE("GraphArTransaction::Rollback");
+    EndWrite();
+}
+
+const std::string& GraphArTransaction::GetStagingPrefix() {
+    if (staging_prefix.empty()) {
+        const auto& prefix = graphar_catalog.GetGraphInfo()->GetPrefix();
+        if (FileSystem::IsRemoteFile(prefix)) {
+            throw NotImplementedException("Writing to a remote GraphAr graph is not supported");
+        }
+        graphar_catalog.LockWriter(*this);
+        staging_prefix = prefix + ".staging/" + UUID::ToString(UUID::GenerateRandomUUID()) + "/";
+        std::filesystem::create_directories(staging_prefix);
+    }
+    return staging_prefix;
+}
+
+void GraphArTransaction::RemoveOnCommit(const std::string& relative_path) {
+    GetStagingPrefix();
+    removed_paths.push_back(relative_path);
+}
+
+std::string GraphArTransaction::GetFilePath(const std::string& relative_path) const {
+    if (!staging_prefix.empty() && std::filesystem::exists(staging_prefix + relative_path)) {
+        return staging_prefix + relative_path;
+    }
+    return graphar_catalog.GetGraphInfo()->GetPrefix() + relative_path;
+}
 
 GraphArTransaction& GraphArTransaction::Get(ClientContext& context, Catalog& catalog) {
     return Transaction::Get(context, catalog).Cast<GraphArTransaction>();
@@ -1,5 +1,9 @@
 #include "storage/graphar_transaction_manager.hpp"
 
+#include "utils/edge_delta.hpp"
+
+#include <duckdb/common/exception/transaction_exception.hpp>
+#include <duckdb/common/file_system.hpp>
 #include <duckdb/main/attached_database.hpp>
 
 namespace duckdb {
@@ -18,10 +22,15 @@ Transaction& GraphArTransactionManager::StartTransaction(ClientContext& context)
 
 ErrorData GraphArTransactionManager::CommitTransaction(ClientContext& context, Transaction& transaction) {
     auto& graphar_transaction = transaction.Cast<GraphArTransaction>();
-    graphar_transaction.Commit();
+    ErrorData error;
+    try {
+        graphar_transaction.Commit();
+    } catch (std::exception& ex) {
+        error = ErrorData(ex);
+    }
     lock_guard<mutex> l(transaction_lock);
     transactions.erase(transaction);
-    return ErrorData();
+    return error;
 }
 
 void GraphArTransactionManager::RollbackTransaction(Transaction& transaction) {
@@ -31,8 +40,32 @@ void GraphArTransactionManager::RollbackTransaction(Transaction& transaction) {
     transactions.erase(transaction);
 }
 
+// Merges the delta chunks of every edge type into its sorted adjacency lists, and extends the adjacency lists of edge
+// types whose vertices grew. The rewritten chunks are staged by the transaction the checkpoint runs in, which removes
+// the merged delta chunks when it commits. The delta chunks are counted under the writer lock of that transaction, so
+// no other transaction commits delta chunks in between.
 void GraphArTransactionManager::Checkpoint(ClientContext& context, bool force) {
-    throw NotImplementedException("GraphArTransactionManager::Checkpoint");
+    auto& transaction = GraphArTransaction::Get(context, graphar_catalog);
+    if (transaction.HasWrites()) {
+        throw TransactionException("Cannot checkpoint a GraphAr graph in a transaction that wrote to it");
+    }
+    const auto& graph_info = graphar_catalog.GetGraphInfo();
+    const auto& prefix = graph_info->GetPrefix();
+    // only attached local graphs are written to
+    if (FileSystem::IsRemoteFile(prefix)) {
+        return;
+    }
+    const auto& staging_prefix = transaction.GetStagingPrefix();
+    for (const auto& edge_info : graph_info->GetEdgeInfos()) {
+        const auto chunk_num = EdgeDelta::GetChunkNum(FileSystem::GetFileSystem(context), prefix, *edge_info);
+        EdgeDelta::Compact(context, graph_info, edge_info, chunk_num, staging_prefix);
+        for (idx_t chunk = 0; chunk < chunk_num; ++chunk) {
+            transaction.RemoveOnCommit(EdgeDelta::GetChunkPath(*edge_info, chunk));
+        }
+        if (chunk_num > 0) {
+            transaction.RemoveOnCommit(EdgeDelta::GetCountPath(*edge_info));
+        }
+    }
 }
 
 }  // namespace duckdb
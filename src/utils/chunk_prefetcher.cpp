@@ -0,0 +1,157 @@
+#include "utils/chunk_prefetcher.hpp"
+
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/parallel/task.hpp>
+#include <duckdb/parallel/task_scheduler.hpp>
+
+#include <arrow/util/byte_size.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+namespace duckdb {
+
+enum class PrefetchStatus : uint8_t { IDLE, SCHEDULED, READING };
+
+struct ChunkPrefetchState {
+    ChunkPrefetchState(TaskScheduler& scheduler, ChunkPrefetcher::ReadFunction read, idx_t depth, idx_t memory_limit)
+        : scheduler(scheduler), producer(scheduler.CreateProducer()), read(std::move(read)), depth(depth),
+          memory_limit(memory_limit) {}
+
+    TaskScheduler& scheduler;
+    unique_ptr<ProducerToken> producer;
+    ChunkPrefetcher::ReadFunction read;
+    const idx_t depth;
+    const idx_t memory_limit;
+
+    std::mutex lock;
+    std::condition_variable queue_changed;
+    std::deque<std::pair<PrefetchedPartition, idx_t>> queue;
+    idx_t queued_bytes = 0;
+    PrefetchStatus status = PrefetchStatus::IDLE;
+    bool finished = false;
+    bool stopped = false;
+    std::exception_ptr error;
+
+    // the queue may always take one partition, whatever its size
+    bool HasRoom() const {
+        return !finished && !stopped && (queue.empty() || (queue.size() < depth && queued_bytes < memory_limit));
+    }
+
+    // Reads one partition with the lock released; status is READING on entry and IDLE on return
+    void ReadOne(std::unique_lock<std::mutex>& guard);
+
+    void Schedule(const shared_ptr<ChunkPrefetchState>& self);
+};
+
+class ChunkPrefetchTask : public Task {
+public:
+    explicit ChunkPrefetchTask(shared_ptr<ChunkPrefetchState> state) : state(std::move(state)) {}
+
+    TaskExecutionResult Execute(TaskExecutionMode mode) override {
+        std::unique_lock<std::mutex> guard(state->lock);
+        // the scan thread may have read the partition itself or finished the scan in the meantime
+        if (state->status != PrefetchStatus::SCHEDULED || state->stopped) {
+            return TaskExecutionResult::TASK_FINISHED;
+        }
+        state->status = PrefetchStatus::READING;
+        while (true) {
+            state->ReadOne(guard);
+            if (!state->HasRoom()) {
+                return TaskExecutionResult::TASK_FINISHED;
+            }
+            state->status = PrefetchStatus::READING;
+        }
+    }
+
+    string TaskType() const override {
+        return "ChunkPrefetchTask";
+    }
+
+private:
+    shared_ptr<ChunkPrefetchState> state;
+};
+
+void ChunkPrefetchState::ReadOne(std::unique_lock<std::mutex>& guard) {
+    guard.unlock();
+    PrefetchedPartition partition;
+    bool has_partition = false;
+    std::exception_ptr read_error;
+    try {
+        has_partition = read(partition);
+    } catch (...) {
+        read_error = std::current_exception();
+    }
+    idx_t bytes = 0;
+    if (has_partition) {
+        for (const auto& table : partition.tables) {
+            bytes += arrow::util::TotalBufferSize(*table);
+        }
+    }
+    guard.lock();
+    status = PrefetchStatus::IDLE;
+    if (read_error) {
+        error = read_error;
+        finished = true;
+    } else if (!has_partition) {
+        finished = true;
+    } else {
+        DUCKDB_GRAPHAR_LOG_DEBUG("Prefetched partition " + std::to_string(partition.partition_index) + " (" +
+                                 std::to_string(bytes) + " bytes)");
+        queued_bytes += bytes;
+        queue.emplace_back(std::move(partition), bytes);
+    }
+    queue_changed.notify_all();
+}
+
+void ChunkPrefetchState::Schedule(const shared_ptr<ChunkPrefetchState>& self) {
+    if (status != PrefetchStatus::IDLE || !HasRoom()) {
+        return;
+    }
+    status = PrefetchStatus::SCHEDULED;
+    scheduler.ScheduleTask(*producer, make_shared_ptr<ChunkPrefetchTask>(self));
+}
+
+ChunkPrefetcher::ChunkPrefetcher(ClientContext& context, ReadFunction read, idx_t depth, idx_t memory_limit)
+    : state(make_shared_ptr<ChunkPrefetchState>(TaskScheduler::GetScheduler(context), std::move(read),
+                                                std::max<idx_t>(depth, 1), memory_limit)) {
+    std::lock_guard<std::mutex> guard(state->lock);
+    state->Schedule(state);
+}
+
+ChunkPrefetcher::~ChunkPrefetcher() {
+    std::unique_lock<std::mutex> guard(state->lock);
+    state->stopped = true;
+    // a read in progress uses the scan state, so it is finished before the scan state goes away; a task that has not
+    // started yet sees the stop and returns without reading
+    state->queue_changed.wait(guard, [&]() { return state->status != PrefetchStatus::READING; });
+}
+
+bool ChunkPrefetcher::Next(PrefetchedPartition& result) {
+    std::unique_lock<std::mutex> guard(state->lock);
+    while (state->queue.empty() && !state->finished) {
+        if (state->status == PrefetchStatus::READING) {
+            state->queue_changed.wait(guard);
+            continue;
+        }
+        // no idle thread has picked the task up yet, so the partition is read here
+        state->status = PrefetchStatus::READING;
+        state->ReadOne(guard);
+    }
+    if (state->queue.empty()) {
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+        return false;
+    }
+    result = std::move(state->queue.front().first);
+    state->queued_bytes -= state->queue.front().second;
+    state->queue.pop_front();
+    state->Schedule(state);
+    return true;
+}
+
+}  // namespace duckdb
@@ -0,0 +1,169 @@
+#include "utils/degree_index.hpp"
+
+#include "utils/edge_delta.hpp"
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/common/exception.hpp>
+#include <duckdb/main/client_context.hpp>
+
+#include <cstring>
+
+namespace duckdb {
+
+static constexpr char DEGREE_INDEX_MAGIC[8] = {'G', 'A', 'R', 'D', 'E', 'G', '0', '1'};
+
+struct DegreeIndexHeader {
+    char magic[8];
+    uint64_t vertex_count;
+    uint64_t vertex_chunk_size;
+    uint64_t chunk_num;
+};
+
+struct DegreeIndexChunk {
+    // stamp of the offset file the degrees were computed from
+    uint64_t file_size;
+    int64_t last_modified;
+    int64_t min;
+    int64_t max;
+    int64_t sum;
+};
+
+std::string DegreeIndex::GetPath(const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& prefix,
+                                 graphar::AdjListType adj_list_type) {
+    return prefix + edge_info->GetPrefix() + "degree_index/" + std::string(AdjListTypeToString(adj_list_type)) +
+           ".degree";
+}
+
+idx_t DegreeIndex::Build(ClientContext& context, const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                         const std::string& prefix, graphar::AdjListType adj_list_type) {
+    DUCKDB_GRAPHAR_LOG_TRACE("DegreeIndex::Build");
+    auto& fs = FileSystem::GetFileSystem(context);
+    const auto path = GetPath(edge_info, prefix, adj_list_type);
+    const auto directory = GetDirectory(path);
+    if (!fs.DirectoryExists(directory)) {
+        fs.CreateDirectory(directory);
+    }
+
+    DegreeIndexHeader header;
+    std::memcpy(header.magic, DEGREE_INDEX_MAGIC, sizeof(header.magic));
+    header.vertex_count = GetVertexCount(edge_info, prefix, adj_list_type);
+    header.vertex_chunk_size = GetAdjListVertexChunkSize(edge_info, adj_list_type);
+    header.chunk_num = (header.vertex_count + header.vertex_chunk_size - 1) / header.vertex_chunk_size;
+    std::vector<DegreeIndexChunk> chunks(header.chunk_num);
+    const idx_t data_offset = sizeof(header) + chunks.size() * sizeof(DegreeIndexChunk);
+
+    // Written to a temporary file first, so that readers never see a partial index
+    const auto tmp_path = path + ".tmp";
+    auto handle = fs.OpenFile(tmp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+    std::vector<int64_t> degrees;
+    for (idx_t chunk_index = 0; chunk_index < header.chunk_num; ++chunk_index) {
+        const idx_t begin = chunk_index * header.vertex_chunk_size;
+        const idx_t count = std::min<idx_t>(header.vertex_chunk_size, header.vertex_count - begin);
+        auto offsets = ReadOffsetChunk(edge_info, prefix, adj_list_type, chunk_index);
+        if (offsets->length() < static_cast<int64_t>(count + 1)) {
+            throw IOException("Offset chunk " + std::to_string(chunk_index) + " of " +
+                              GraphArFunctions::GetNameFromInfo(edge_info) + " is shorter than its vertex chunk");
+        }
+        const auto stamp =
+            GetFileStamp(context, GetOffsetChunkPath(edge_info, prefix, adj_list_type, chunk_index));
+        auto& chunk = chunks[chunk_index];
+        chunk.file_size = stamp.size;
+        chunk.last_modified = stamp.last_modified.value;
+        chunk.min = NumericLimits<int64_t>::Maximum();
+        chunk.max = NumericLimits<int64_t>::Minimum();
+        chunk.sum = offsets->Value(count) - offsets->Value(0);
+        degrees.resize(count);
+        for (idx_t i = 0; i < count; ++i) {
+            degrees[i] = offsets->Value(i + 1) - offsets->Value(i);
+            chunk.min = std::min(chunk.min, degrees[i]);
+            chunk.max = std::max(chunk.max, degrees[i]);
+        }
+        handle->Write(degrees.data(), count * sizeof(int64_t), data_offset + begin * sizeof(int64_t));
+    }
+    handle->Write(&header, sizeof(header), 0);
+    handle->Write(chunks.data(), chunks.size() * sizeof(DegreeIndexChunk), sizeof(header));
+    handle->Sync();
+    handle->Close();
+    fs.MoveFile(tmp_path, path);
+    DUCKDB_GRAPHAR_LOG_DEBUG("Degree index written to " + path);
+    return header.vertex_count;
+}
+
+unique_ptr<DegreeIndex> DegreeIndex::Open(ClientContext& context, const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                                          const std::string& prefix, graphar::AdjListType adj_list_type) {
+    DUCKDB_GRAPHAR_LOG_TRACE("DegreeIndex::Open");
+    auto& fs = FileSystem::GetFileSystem(context);
+    const auto path = GetPath(edge_info, prefix, adj_list_type);
+    if (!edge_info->HasAdjacentListType(adj_list_type) || !fs.FileExists(path)) {
+        return nullptr;
+    }
+    if (EdgeDelta::GetChunkNum(fs, prefix, *edge_info) > 0) {
+        DUCKDB_GRAPHAR_LOG_DEBUG("Degree index of " + path + " misses the inserted edges until a checkpoint");
+        return nullptr;
+    }
+    auto result = make_uniq<DegreeIndex>();
+    result->handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+
+    DegreeIndexHeader header;
+    if (result->handle->GetFileSize() < sizeof(header)) {
+        return nullptr;
+    }
+    result->handle->Read(&header, sizeof(header), 0);
+    if (std::memcmp(header.magic, DEGREE_INDEX_MAGIC, sizeof(header.magic)) != 0 ||
+        header.vertex_chunk_size != GetAdjListVertexChunkSize(edge_info, adj_list_type) ||
+        header.vertex_count != static_cast<uint64_t>(GetVertexCount(edge_info, prefix, adj_list_type))) {
+        DUCKDB_GRAPHAR_LOG_DEBUG("Degree index " + path + " does not match the graph");
+        return nullptr;
+    }
+    std::vector<DegreeIndexChunk> chunks(header.chunk_num);
+    result->data_offset = sizeof(header) + chunks.size() * sizeof(DegreeIndexChunk);
+    if (result->handle->GetFileSize() != result->data_offset + header.vertex_count * sizeof(int64_t)) {
+        return nullptr;
+    }
+    result->handle->Read(chunks.data(), chunks.size() * sizeof(DegreeIndexChunk), sizeof(header));
+    for (idx_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index) {
+        const auto& chunk = chunks[chunk_index];
+        const auto stamp =
+            GetFileStamp(context, GetOffsetChunkPath(edge_info, prefix, adj_list_type, chunk_index));
+        if (stamp.size != chunk.file_size || stamp.last_modified.value != chunk.last_modified) {
+            DUCKDB_GRAPHAR_LOG_DEBUG("Degree index " + path + " is stale");
+            return nullptr;
+        }
+        result->summaries.push_back({chunk.min, chunk.max, chunk.sum});
+    }
+    result->vertex_count = header.vertex_count;
+    result->vertex_chunk_size = header.vertex_chunk_size;
+    return result;
+}
+
+DegreeSummary DegreeIndex::GetSummary() const {
+    DegreeSummary result;
+    if (summaries.empty()) {
+        return result;
+    }
+    result.min = NumericLimits<int64_t>::Maximum();
+    result.max = NumericLimits<int64_t>::Minimum();
+    for (const auto& summary : summaries) {
+        result.min = std::min(result.min, summary.min);
+        result.max = std::max(result.max, summary.max);
+        result.sum += summary.sum;
+    }
+    return result;
+}
+
+void DegreeIndex::Read(idx_t begin, idx_t count, int64_t* degrees) const {
+    D_ASSERT(begin + count <= vertex_count);
+    handle->Read(degrees, count * sizeof(int64_t), data_offset + begin * sizeof(int64_t));
+}
+
+int64_t DegreeIndex::GetDegree(idx_t vid) const {
+    if (vid >= vertex_count) {
+        return 0;
+    }
+    int64_t degree;
+    Read(vid, 1, &degree);
+    return degree;
+}
+
+}  // namespace duckdb
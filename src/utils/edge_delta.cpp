@@ -0,0 +1,286 @@
+#include "utils/edge_delta.hpp"
+
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/common/exception.hpp>
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/main/client_context.hpp>
+
+#include <arrow/compute/api.h>
+#include <arrow/io/memory.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/metadata.h>
+
+#include <graphar/arrow/chunk_writer.h>
+#include <graphar/filesystem.h>
+
+#include <cstring>
+#include <map>
+
+namespace duckdb {
+
+std::string EdgeDelta::GetDirectory(const graphar::EdgeInfo& edge_info) { return edge_info.GetPrefix() + "delta/"; }
+
+std::string EdgeDelta::GetChunkPath(const graphar::EdgeInfo& edge_info, idx_t chunk) {
+    return GetDirectory(edge_info) + "chunk" + std::to_string(chunk);
+}
+
+std::string EdgeDelta::GetCountPath(const graphar::EdgeInfo& edge_info) {
+    return GetDirectory(edge_info) + "delta_count";
+}
+
+static std::shared_ptr<graphar::FileSystem> GetFileSystem(const std::string& prefix) {
+    std::string out_prefix;
+    GAR_ASSIGN_OR_RAISE_ERROR(auto fs, graphar::FileSystemFromUriOrPath(prefix, &out_prefix));
+    return fs;
+}
+
+idx_t EdgeDelta::GetChunkNum(FileSystem& fs, const std::string& prefix, const graphar::EdgeInfo& edge_info) {
+    // only attached local graphs are written to
+    if (FileSystem::IsRemoteFile(prefix)) {
+        return 0;
+    }
+    return ReadCount(fs, prefix + GetCountPath(edge_info), 0);
+}
+
+// Rows of a Parquet file, from the footer at its end: the serialized metadata, its length and the magic "PAR1"
+static idx_t ReadParquetRowNum(FileSystem& fs, const std::string& path) {
+    static constexpr idx_t TAIL_SIZE = 8;
+    auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+    const auto file_size = handle->GetFileSize();
+    char tail[TAIL_SIZE];
+    if (file_size < TAIL_SIZE) {
+        throw IOException(path + " is not a Parquet file");
+    }
+    handle->Read(tail, TAIL_SIZE, file_size - TAIL_SIZE);
+    uint32_t metadata_size;
+    std::memcpy(&metadata_size, tail, sizeof(metadata_size));
+    if (std::memcmp(tail + sizeof(metadata_size), "PAR1", 4) != 0 || metadata_size > file_size - TAIL_SIZE) {
+        throw IOException(path + " is not a Parquet file");
+    }
+    std::vector<char> metadata(metadata_size);
+    handle->Read(metadata.data(), metadata_size, file_size - TAIL_SIZE - metadata_size);
+    return parquet::FileMetaData::Make(metadata.data(), &metadata_size)->num_rows();
+}
+
+idx_t EdgeDelta::GetRowNum(FileSystem& fs, const std::string& prefix, const graphar::EdgeInfo& edge_info) {
+    idx_t rows = 0;
+    const auto chunk_num = GetChunkNum(fs, prefix, edge_info);
+    for (idx_t chunk = 0; chunk < chunk_num; ++chunk) {
+        rows += ReadParquetRowNum(fs, prefix + GetChunkPath(edge_info, chunk));
+    }
+    return rows;
+}
+
+std::shared_ptr<arrow::Table> EdgeDelta::ReadChunk(const std::string& prefix, const graphar::EdgeInfo& edge_info,
+                                                   idx_t chunk) {
+    GAR_ASSIGN_OR_RAISE_ERROR(auto table, GetFileSystem(prefix)->ReadFileToTable(
+                                              prefix + GetChunkPath(edge_info, chunk), graphar::FileType::PARQUET));
+    return table;
+}
+
+static std::shared_ptr<arrow::Table> Concatenate(const std::vector<std::shared_ptr<arrow::Table>>& tables,
+                                                 const std::string& what) {
+    auto maybe_table = arrow::ConcatenateTables(tables);
+    if (!maybe_table.ok()) {
+        throw IOException("Failed to concatenate " + what + ": " + maybe_table.status().message());
+    }
+    return maybe_table.ValueUnsafe();
+}
+
+std::shared_ptr<arrow::Table> EdgeDelta::Read(FileSystem& fs, const std::string& prefix,
+                                              const graphar::EdgeInfo& edge_info) {
+    return Read(prefix, edge_info, GetChunkNum(fs, prefix, edge_info));
+}
+
+std::shared_ptr<arrow::Table> EdgeDelta::Read(const std::string& prefix, const graphar::EdgeInfo& edge_info,
+                                              idx_t chunk_num) {
+    if (chunk_num == 0) {
+        return nullptr;
+    }
+    std::vector<std::shared_ptr<arrow::Table>> chunks;
+    for (idx_t chunk = 0; chunk < chunk_num; ++chunk) {
+        chunks.push_back(ReadChunk(prefix, edge_info, chunk));
+    }
+    return Concatenate(chunks, "delta chunks");
+}
+
+void EdgeDelta::WriteChunk(FileSystem& fs, const std::shared_ptr<arrow::Table>& table, const std::string& path) {
+    auto maybe_stream = arrow::io::BufferOutputStream::Create();
+    if (!maybe_stream.ok()) {
+        throw IOException("Failed to write delta chunk " + path + ": " + maybe_stream.status().message());
+    }
+    auto stream = maybe_stream.ValueUnsafe();
+    auto status = parquet::arrow::WriteTable(*table, arrow::default_memory_pool(), stream,
+                                             std::max<int64_t>(table->num_rows(), 1));
+    if (!status.ok()) {
+        throw IOException("Failed to write delta chunk " + path + ": " + status.message());
+    }
+    auto maybe_buffer = stream->Finish();
+    if (!maybe_buffer.ok()) {
+        throw IOException("Failed to write delta chunk " + path + ": " + maybe_buffer.status().message());
+    }
+    const auto& buffer = maybe_buffer.ValueUnsafe();
+
+    fs.CreateDirectoriesRecursive(GetDirectory(path));
+    auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+    handle->Write(const_cast<uint8_t*>(buffer->data()), buffer->size(), 0);
+    handle->Sync();
+    handle->Close();
+}
+//-------------------------------------------------------------------
+// Compact
+//-------------------------------------------------------------------
+// Columns of the delta chunks: the src and dst ids and every property of the edges
+static std::shared_ptr<arrow::Schema> GetDeltaSchema(const graphar::EdgeInfo& edge_info) {
+    std::vector<std::string> names = {SRC_GID_COLUMN, DST_GID_COLUMN};
+    std::vector<std::string> types = {"int64", "int64"};
+    for (const auto& pg : edge_info.GetPropertyGroups()) {
+        for (const auto& property : pg->GetProperties()) {
+            names.push_back(property.name);
+            types.push_back(property.type->ToTypeName());
+        }
+    }
+    return GraphArFunctions::EmptyTableFromNamesAndTypes(names, types)->schema();
+}
+
+// What a checkpoint merges for one edge type
+struct EdgeDeltaCompaction {
+    std::shared_ptr<graphar::EdgeInfo> edge_info;
+    std::string prefix;
+    // counts are read through the file system of the database, chunks through the one of GraphAr
+    FileSystem* local_fs;
+    std::shared_ptr<graphar::FileSystem> fs;
+    std::shared_ptr<arrow::Schema> schema;
+    // the delta edges in the columns of the schema, nullptr when there are none
+    std::shared_ptr<arrow::Table> delta;
+    // per adjacency list, its writer and the rows of the delta per vertex chunk
+    std::vector<graphar::AdjListType> adj_list_types;
+    std::vector<std::shared_ptr<graphar::EdgeChunkWriter>> writers;
+    std::vector<std::map<int64_t, std::vector<int64_t>>> rows;
+};
+
+static std::shared_ptr<arrow::Table> ReadBaseVertexChunk(const EdgeDeltaCompaction& compaction,
+                                                         graphar::AdjListType adj_list_type,
+                                                         graphar::IdType vertex_chunk) {
+    const auto& edge_info = compaction.edge_info;
+    GAR_ASSIGN_OR_RAISE_ERROR(auto count_path, edge_info->GetEdgesNumFilePath(vertex_chunk, adj_list_type));
+    const auto edge_num = ReadCount(*compaction.local_fs, compaction.prefix + count_path, 0);
+    const auto file_type = edge_info->GetAdjacentList(adj_list_type)->GetFileType();
+    std::vector<std::shared_ptr<arrow::Table>> chunks;
+    for (graphar::IdType chunk = 0; chunk * edge_info->GetChunkSize() < edge_num; ++chunk) {
+        std::vector<std::shared_ptr<arrow::Table>> tables;
+        GAR_ASSIGN_OR_RAISE_ERROR(auto adj_path, edge_info->GetAdjListFilePath(vertex_chunk, chunk, adj_list_type));
+        GAR_ASSIGN_OR_RAISE_ERROR(auto adj_table,
+                                  compaction.fs->ReadFileToTable(compaction.prefix + adj_path, file_type));
+        tables.push_back(std::move(adj_table));
+        for (const auto& pg : edge_info->GetPropertyGroups()) {
+            GAR_ASSIGN_OR_RAISE_ERROR(auto path,
+                                      edge_info->GetPropertyFilePath(pg, adj_list_type, vertex_chunk, chunk));
+            GAR_ASSIGN_OR_RAISE_ERROR(auto table,
+                                      compaction.fs->ReadFileToTable(compaction.prefix + path, pg->GetFileType()));
+            tables.push_back(std::move(table));
+        }
+        chunks.push_back(AssembleTable(compaction.schema, tables));
+    }
+    if (chunks.empty()) {
+        return arrow::Table::MakeEmpty(compaction.schema).ValueOrDie();
+    }
+    return Concatenate(chunks, "edge chunks");
+}
+
+// Sorts the base edges of one vertex chunk together with its delta edges and writes the chunk anew
+static void CompactVertexChunk(const EdgeDeltaCompaction& compaction, idx_t adj_i, int64_t vertex_chunk,
+                               const std::vector<int64_t>& rows) {
+    const auto adj_list_type = compaction.adj_list_types[adj_i];
+    auto table = ReadBaseVertexChunk(compaction, adj_list_type, vertex_chunk);
+    if (!rows.empty()) {
+        auto indices = std::make_shared<arrow::Int64Array>(rows.size(), arrow::Buffer::Wrap(rows));
+        auto maybe_delta = arrow::compute::Take(compaction.delta, indices);
+        if (!maybe_delta.ok()) {
+            throw IOException("Failed to select delta edges: " + maybe_delta.status().message());
+        }
+        table = Concatenate({table, maybe_delta.ValueUnsafe().table()}, "delta edges");
+    }
+    const auto what =
+        std::string(AdjListTypeToString(adj_list_type)) + " edges of vertex chunk " + std::to_string(vertex_chunk);
+    CheckWriteStatus(compaction.writers[adj_i]->SortAndWriteAdjListTable(table, vertex_chunk, 0), what);
+    CheckWriteStatus(compaction.writers[adj_i]->WriteEdgesNum(vertex_chunk, table->num_rows()), what);
+}
+
+idx_t EdgeDelta::Compact(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                         const std::shared_ptr<graphar::EdgeInfo>& edge_info, idx_t chunk_num,
+                         const std::string& output_prefix) {
+    DUCKDB_GRAPHAR_LOG_TRACE("EdgeDelta::Compact");
+    EdgeDeltaCompaction compaction;
+    compaction.edge_info = edge_info;
+    compaction.prefix = graph_info->GetPrefix();
+    compaction.local_fs = &FileSystem::GetFileSystem(context);
+    compaction.fs = GetFileSystem(compaction.prefix);
+    compaction.schema = GetDeltaSchema(*edge_info);
+    auto delta = Read(compaction.prefix, *edge_info, chunk_num);
+    if (delta) {
+        compaction.delta = AssembleTable(compaction.schema, {delta})->CombineChunks().ValueOrDie();
+    }
+
+    const std::string vertex_types[] = {edge_info->GetSrcType(), edge_info->GetDstType()};
+    const int64_t vertex_chunk_sizes[] = {edge_info->GetSrcChunkSize(), edge_info->GetDstChunkSize()};
+    int64_t vertex_nums[2];
+    for (idx_t side = 0; side < 2; ++side) {
+        GAR_ASSIGN_OR_RAISE_ERROR(auto count_path,
+                                  graph_info->GetVertexInfo(vertex_types[side])->GetVerticesNumFilePath());
+        vertex_nums[side] = ReadCount(*compaction.local_fs, compaction.prefix + count_path, 0);
+    }
+
+    // every vertex chunk with delta edges is rewritten, and so are the vertex chunks vertices were appended to since
+    // the adjacency list was written, whose offsets and vertex count have to cover the new vertices
+    std::vector<std::pair<idx_t, int64_t>> jobs;
+    for (auto type : {graphar::AdjListType::ordered_by_source, graphar::AdjListType::ordered_by_dest,
+                      graphar::AdjListType::unordered_by_source, graphar::AdjListType::unordered_by_dest}) {
+        if (!edge_info->HasAdjacentListType(type)) {
+            continue;
+        }
+        const auto side = GetAdjListSide(type);
+        compaction.adj_list_types.push_back(type);
+        auto& vertex_chunks = compaction.rows.emplace_back();
+        if (compaction.delta) {
+            auto ids = std::static_pointer_cast<arrow::Int64Array>(
+                compaction.delta->GetColumnByName(side ? DST_GID_COLUMN : SRC_GID_COLUMN)->chunk(0));
+            for (int64_t row = 0; row < ids->length(); ++row) {
+                vertex_chunks[ids->Value(row) / vertex_chunk_sizes[side]].push_back(row);
+            }
+        }
+        GAR_ASSIGN_OR_RAISE_ERROR(auto count_path, edge_info->GetVerticesNumFilePath(type));
+        const auto old_vertex_num = ReadCount(*compaction.local_fs, compaction.prefix + count_path, vertex_nums[side]);
+        if (old_vertex_num < vertex_nums[side]) {
+            for (auto vertex_chunk = old_vertex_num / vertex_chunk_sizes[side];
+                 vertex_chunk * vertex_chunk_sizes[side] < vertex_nums[side]; ++vertex_chunk) {
+                vertex_chunks.emplace(vertex_chunk, std::vector<int64_t>());
+            }
+        }
+        for (const auto& entry : vertex_chunks) {
+            jobs.emplace_back(compaction.adj_list_types.size() - 1, entry.first);
+        }
+    }
+    if (jobs.empty()) {
+        return 0;
+    }
+    for (idx_t adj_i = 0; adj_i < compaction.adj_list_types.size(); ++adj_i) {
+        const auto type = compaction.adj_list_types[adj_i];
+        GAR_ASSIGN_OR_RAISE_ERROR(auto writer, graphar::EdgeChunkWriter::Make(edge_info, output_prefix, type));
+        CheckWriteStatus(writer->WriteVerticesNum(vertex_nums[GetAdjListSide(type)]), "vertex count");
+        compaction.writers.push_back(std::move(writer));
+    }
+
+    RunParallel(context, jobs.size(), [&](idx_t job) {
+        CompactVertexChunk(compaction, jobs[job].first, jobs[job].second,
+                           compaction.rows[jobs[job].first].at(jobs[job].second));
+    });
+    const idx_t merged = compaction.delta ? compaction.delta->num_rows() : 0;
+    DUCKDB_GRAPHAR_LOG_DEBUG("Compacted " + std::to_string(merged) + " delta edges into " +
+                             std::to_string(jobs.size()) + " vertex chunks");
+    return merged;
+}
+
+}  // namespace duckdb
@@ -1,17 +1,32 @@
 #include "utils/func.hpp"
 
+#include "utils/edge_delta.hpp"
 #include "utils/global_log_manager.hpp"
+#include "utils/table_storage_stats.hpp"
 
+#include <arrow/compute/api.h>
+#include <arrow/filesystem/api.h>
+
+#include <duckdb/common/exception.hpp>
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/common/string_util.hpp>
 #include <duckdb/common/types.hpp>
 #include <duckdb/common/types/data_chunk.hpp>
+#include <duckdb/common/types/hash.hpp>
+#include <duckdb/main/client_context.hpp>
+#include <duckdb/parallel/task_executor.hpp>
 
 #include <graphar/expression.h>
 #include <graphar/filesystem.h>
 #include <graphar/graph_info.h>
+#include <graphar/reader_util.h>
 #include <graphar/types.h>
 
+#include <parquet/arrow/reader.h>
+
 #include <duckdb.hpp>
 #include <iostream>
+#include <numeric>
 
 namespace duckdb {
 
@@ -177,10 +192,638 @@ std::int64_t GetCount(const std::string& path) {
     return fs->ReadFileToValue<graphar::IdType>(path).value();
 }
 
-std::int64_t GetVertexCount(const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& directory) {
-    std::string vertex_num_path = edge_info->GetVerticesNumFilePath(graphar::AdjListType::ordered_by_source).value();
+std::int64_t GetVertexCount(const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& directory,
+                            graphar::AdjListType adj_list_type) {
+    std::string vertex_num_path = edge_info->GetVerticesNumFilePath(adj_list_type).value();
 
     return GetCount(directory + vertex_num_path);
 }
 
+idx_t GetAdjListVertexChunkSize(const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                                graphar::AdjListType adj_list_type) {
+    if (adj_list_type == graphar::AdjListType::ordered_by_source) {
+        return edge_info->GetSrcChunkSize();
+    }
+    if (adj_list_type == graphar::AdjListType::ordered_by_dest) {
+        return edge_info->GetDstChunkSize();
+    }
+    throw InvalidInputException("Expected an ordered adjacency list, but got " +
+                                std::string(AdjListTypeToString(adj_list_type)));
+}
+
+std::shared_ptr<arrow::Int64Array> ReadOffsetChunk(const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                                                   const std::string& prefix, graphar::AdjListType adj_list_type,
+                                                   graphar::IdType vertex_chunk_index) {
+    auto adjacent_list = edge_info->GetAdjacentList(adj_list_type);
+    if (adjacent_list == nullptr) {
+        throw InvalidInputException("The adjacent list is not set for adj list type " +
+                                    std::string(AdjListTypeToString(adj_list_type)));
+    }
+    std::string out_prefix;
+    GAR_ASSIGN_OR_RAISE_ERROR(auto fs, graphar::FileSystemFromUriOrPath(prefix, &out_prefix));
+    GAR_ASSIGN_OR_RAISE_ERROR(
+        auto table, fs->ReadFileToTable(GetOffsetChunkPath(edge_info, out_prefix, adj_list_type, vertex_chunk_index),
+                                        adjacent_list->GetFileType()));
+    auto column = table->column(0);
+    if (column->num_chunks() == 1) {
+        return std::static_pointer_cast<arrow::Int64Array>(column->chunk(0));
+    }
+    auto maybe_array = arrow::Concatenate(column->chunks());
+    if (!maybe_array.ok()) {
+        throw IOException("Failed to read offset chunk: " + maybe_array.status().message());
+    }
+    return std::static_pointer_cast<arrow::Int64Array>(maybe_array.ValueUnsafe());
+}
+
+std::string GetOffsetChunkPath(const std::shared_ptr<graphar::EdgeInfo>& edge_info, const std::string& prefix,
+                               graphar::AdjListType adj_list_type, graphar::IdType vertex_chunk_index) {
+    GAR_ASSIGN_OR_RAISE_ERROR(auto offset_file_path,
+                              edge_info->GetAdjListOffsetFilePath(vertex_chunk_index, adj_list_type));
+    return prefix + offset_file_path;
+}
+
+idx_t GetAdjListSide(graphar::AdjListType adj_list_type) {
+    return adj_list_type == graphar::AdjListType::ordered_by_source ||
+                   adj_list_type == graphar::AdjListType::unordered_by_source
+               ? 0
+               : 1;
+}
+
+int64_t ReadCount(FileSystem& fs, const std::string& path, int64_t default_value) {
+    if (!fs.FileExists(path)) {
+        return default_value;
+    }
+    auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+    if (handle->GetFileSize() < sizeof(graphar::IdType)) {
+        throw IOException("Count file " + path + " is truncated");
+    }
+    graphar::IdType count;
+    handle->Read(&count, sizeof(count), 0);
+    return count;
+}
+
+std::shared_ptr<arrow::Table> AssembleTable(const std::shared_ptr<arrow::Schema>& schema,
+                                            const std::vector<std::shared_ptr<arrow::Table>>& tables) {
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+    for (const auto& field : schema->fields()) {
+        std::shared_ptr<arrow::ChunkedArray> column;
+        for (const auto& table : tables) {
+            column = table->GetColumnByName(field->name());
+            if (column) {
+                break;
+            }
+        }
+        if (!column) {
+            throw IOException("Column " + field->name() + " is missing from the stored chunk");
+        }
+        if (!column->type()->Equals(field->type())) {
+            throw IOException("Column " + field->name() + " is stored as " + column->type()->ToString() +
+                              " instead of " + field->type()->ToString());
+        }
+        columns.push_back(column);
+    }
+    return arrow::Table::Make(schema, columns);
+}
+
+void CheckWriteStatus(const graphar::Status& status, const std::string& what) {
+    if (!status.ok()) {
+        throw IOException("Failed to write " + what + ": " + status.message());
+    }
+}
+
+// One job of RunParallel; the executor skips the jobs left once one of them failed
+class GraphArJobTask : public BaseExecutorTask {
+public:
+    GraphArJobTask(TaskExecutor& executor, const std::function<void(idx_t)>& job, idx_t index)
+        : BaseExecutorTask(executor), job(job), index(index) {}
+
+    void ExecuteTask() override { job(index); }
+
+private:
+    const std::function<void(idx_t)>& job;
+    idx_t index;
+};
+
+void RunParallel(ClientContext& context, idx_t job_count, const std::function<void(idx_t)>& job) {
+    TaskExecutor executor(context);
+    for (idx_t i = 0; i < job_count; ++i) {
+        executor.ScheduleTask(make_uniq<GraphArJobTask>(executor, job, i));
+    }
+    executor.WorkOnTasks();
+}
+
+std::shared_ptr<arrow::Table> ReadParquetRows(const std::string& prefix, const std::string& path, idx_t begin,
+                                              idx_t count) {
+    std::string out_prefix;
+    auto maybe_fs = arrow::fs::FileSystemFromUriOrPath(prefix, &out_prefix);
+    if (!maybe_fs.ok()) {
+        throw IOException("Failed to open file system of " + prefix + ": " + maybe_fs.status().message());
+    }
+    auto maybe_file = maybe_fs.ValueUnsafe()->OpenInputFile(out_prefix + path);
+    if (!maybe_file.ok()) {
+        throw IOException("Failed to open " + path + ": " + maybe_file.status().message());
+    }
+    parquet::arrow::FileReaderBuilder builder;
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    auto status = builder.Open(maybe_file.ValueUnsafe());
+    if (status.ok()) {
+        status = builder.Build(&reader);
+    }
+    if (!status.ok()) {
+        throw IOException("Failed to read Parquet file " + path + ": " + status.message());
+    }
+
+    const auto metadata = reader->parquet_reader()->metadata();
+    std::vector<int> row_groups;
+    idx_t first_row = 0;
+    idx_t group_begin = 0;
+    for (int i = 0; i < metadata->num_row_groups(); ++i) {
+        const idx_t group_rows = metadata->RowGroup(i)->num_rows();
+        if (group_begin + group_rows > begin && group_begin < begin + count) {
+            if (row_groups.empty()) {
+                first_row = group_begin;
+            }
+            row_groups.push_back(i);
+        }
+        group_begin += group_rows;
+    }
+    DUCKDB_GRAPHAR_LOG_DEBUG("Reading " + std::to_string(row_groups.size()) + " of " +
+                             std::to_string(metadata->num_row_groups()) + " row groups of " + path);
+    std::shared_ptr<arrow::Table> table;
+    status = reader->ReadRowGroups(row_groups, &table);
+    if (!status.ok()) {
+        throw IOException("Failed to read row groups of " + path + ": " + status.message());
+    }
+    return table->Slice(begin - first_row, count);
+}
+
+FileStamp GetFileStamp(ClientContext& context, const std::string& path) {
+    auto& fs = FileSystem::GetFileSystem(context);
+    auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+    FileStamp stamp;
+    stamp.size = handle->GetFileSize();
+    stamp.last_modified = fs.GetLastModifiedTime(*handle);
+    return stamp;
+}
+
+static hash_t HashStamps(hash_t hash, const std::vector<FileStamp>& stamps) {
+    for (const auto& stamp : stamps) {
+        hash = CombineHash(hash, CombineHash(Hash<uint64_t>(stamp.size), Hash<int64_t>(stamp.last_modified.value)));
+    }
+    return hash;
+}
+
+hash_t GetGraphFingerprint(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info) {
+    hash_t result = 0;
+    for (const auto& vertex_info : graph_info->GetVertexInfos()) {
+        result = HashStamps(result, TableStorageStats::GetStamps(context, graph_info, vertex_info));
+    }
+    for (const auto& edge_info : graph_info->GetEdgeInfos()) {
+        result = HashStamps(result, TableStorageStats::GetStamps(context, graph_info, edge_info));
+    }
+    return result;
+}
+
+GraphArDirection ParseDirection(const std::string& direction) {
+    auto lower = StringUtil::Lower(direction);
+    if (lower == "out") {
+        return GraphArDirection::Out;
+    }
+    if (lower == "in") {
+        return GraphArDirection::In;
+    }
+    if (lower == "both") {
+        return GraphArDirection::Both;
+    }
+    throw BinderException("Unknown direction '%s', expected 'out', 'in' or 'both'", direction);
+}
+
+//-------------------------------------------------------------------
+// MyAdjReader
+//-------------------------------------------------------------------
+// Maps each property to the index of its property group in groups, adding groups on first use
+template <typename Info>
+static void ResolvePropertyGroups(const std::shared_ptr<Info>& info, const std::vector<std::string>& properties,
+                                  graphar::PropertyGroupVector& groups, std::vector<idx_t>& group_ids,
+                                  std::vector<std::string>* types = nullptr) {
+    for (const auto& property : properties) {
+        auto pg = info->GetPropertyGroup(property);
+        if (!pg) {
+            throw BinderException("Property '%s' does not exist in %s", property,
+                                  GraphArFunctions::GetNameFromInfo(info));
+        }
+        auto it = std::find(groups.begin(), groups.end(), pg);
+        group_ids.push_back(it - groups.begin());
+        if (it == groups.end()) {
+            groups.push_back(pg);
+        }
+        if (types) {
+            for (const auto& p : pg->GetProperties()) {
+                if (p.name == property) {
+                    types->push_back(p.type->ToTypeName());
+                }
+            }
+        }
+    }
+}
+
+// Counting sort of the edges by the vertex of one side; offsets[vid] is the first row of the edges of the vertex
+static std::shared_ptr<arrow::Table> SortByKey(const std::shared_ptr<arrow::Table>& edges, int key_column,
+                                               std::vector<int64_t>& offsets) {
+    auto table = edges->CombineChunks().ValueOrDie();
+    auto keys = std::static_pointer_cast<arrow::Int64Array>(table->column(key_column)->chunk(0));
+    const int64_t rows = keys->length();
+    const int64_t* key_values = keys->raw_values();
+    int64_t max_key = -1;
+    for (int64_t i = 0; i < rows; ++i) {
+        max_key = std::max(max_key, key_values[i]);
+    }
+    offsets.assign(max_key + 2, 0);
+    for (int64_t i = 0; i < rows; ++i) {
+        offsets[key_values[i] + 1]++;
+    }
+    for (size_t k = 1; k < offsets.size(); ++k) {
+        offsets[k] += offsets[k - 1];
+    }
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    std::vector<int64_t> permutation(rows);
+    for (int64_t i = 0; i < rows; ++i) {
+        permutation[positions[key_values[i]]++] = i;
+    }
+    auto indices = std::make_shared<arrow::Int64Array>(rows, arrow::Buffer::Wrap(permutation));
+    auto maybe_sorted = arrow::compute::Take(table, indices);
+    if (!maybe_sorted.ok()) {
+        throw IOException("Failed to build adjacency index: " + maybe_sorted.status().message());
+    }
+    return maybe_sorted.ValueUnsafe().table();
+}
+
+MyAdjReader::MyAdjReader(FileSystem& fs, const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                         const std::string& prefix, bool by_source, const std::vector<std::string>& edge_properties)
+    : edge_info_(edge_info), prefix_(prefix), by_source_(by_source), properties_(edge_properties) {
+    column_names_ = {SRC_GID_COLUMN, DST_GID_COLUMN};
+    column_types_ = {"int64", "int64"};
+    column_names_.insert(column_names_.end(), properties_.begin(), properties_.end());
+    ResolvePropertyGroups(edge_info_, properties_, property_groups_, property_group_ids_, &column_types_);
+
+    adj_list_type_ = by_source ? graphar::AdjListType::ordered_by_source : graphar::AdjListType::ordered_by_dest;
+    if (edge_info_->HasAdjacentListType(adj_list_type_)) {
+        vertex_chunk_size_ = by_source ? edge_info_->GetSrcChunkSize() : edge_info_->GetDstChunkSize();
+        GAR_ASSIGN_OR_RAISE_ERROR(vertex_chunk_num_,
+                                  graphar::util::GetVertexChunkNum(prefix_, edge_info_, adj_list_type_));
+        GAR_ASSIGN_OR_RAISE_ERROR(reader_, graphar::AdjListArrowChunkReader::Make(edge_info_, adj_list_type_, prefix_));
+        for (const auto& pg : property_groups_) {
+            GAR_ASSIGN_OR_RAISE_ERROR(auto property_reader, graphar::AdjListPropertyArrowChunkReader::Make(
+                                                                edge_info_, pg, adj_list_type_, prefix_));
+            property_readers_.push_back(std::move(property_reader));
+        }
+        auto delta =
+            ReadDelta(fs, GraphArFunctions::EmptyTableFromNamesAndTypes(column_names_, column_types_)->schema());
+        if (delta && delta->num_rows() > 0) {
+            delta_table_ = SortByKey(delta, by_source_ ? 0 : 1, delta_offsets_);
+        }
+        return;
+    }
+    const std::vector<graphar::AdjListType> fallbacks =
+        by_source ? std::vector<graphar::AdjListType>{graphar::AdjListType::unordered_by_source,
+                                                      graphar::AdjListType::ordered_by_dest,
+                                                      graphar::AdjListType::unordered_by_dest}
+                  : std::vector<graphar::AdjListType>{graphar::AdjListType::unordered_by_dest,
+                                                      graphar::AdjListType::ordered_by_source,
+                                                      graphar::AdjListType::unordered_by_source};
+    for (auto adj_list_type : fallbacks) {
+        if (edge_info_->HasAdjacentListType(adj_list_type)) {
+            DUCKDB_GRAPHAR_LOG_DEBUG("Building adjacency index from " +
+                                     std::string(AdjListTypeToString(adj_list_type)));
+            BuildIndex(fs, adj_list_type);
+            return;
+        }
+    }
+    throw InvalidInputException("Edge " + GraphArFunctions::GetNameFromInfo(edge_info_) + " has no adjacency list");
+}
+
+std::shared_ptr<arrow::Table> MyAdjReader::Assemble(
+    const std::shared_ptr<arrow::Table>& adj_table,
+    const std::vector<std::shared_ptr<arrow::Table>>& property_tables) const {
+    if (properties_.empty()) {
+        return adj_table;
+    }
+    std::vector<std::shared_ptr<arrow::Field>> fields = {adj_table->schema()->field(0), adj_table->schema()->field(1)};
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns = {adj_table->column(0), adj_table->column(1)};
+    for (idx_t i = 0; i < properties_.size(); ++i) {
+        const auto& property_table = property_tables[property_group_ids_[i]];
+        auto column = property_table->GetColumnByName(properties_[i]);
+        if (!column || property_table->num_rows() != adj_table->num_rows()) {
+            throw IOException("Edge property '" + properties_[i] + "' is not aligned with the adjacency list");
+        }
+        fields.push_back(arrow::field(properties_[i], column->type()));
+        columns.push_back(std::move(column));
+    }
+    return arrow::Table::Make(arrow::schema(fields), columns, adj_table->num_rows());
+}
+
+// The columns of the schema from the delta chunks of the edges, nullptr when there are none
+std::shared_ptr<arrow::Table> MyAdjReader::ReadDelta(FileSystem& fs,
+                                                     const std::shared_ptr<arrow::Schema>& schema) const {
+    auto delta = EdgeDelta::Read(fs, prefix_, *edge_info_);
+    if (!delta) {
+        return nullptr;
+    }
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+    for (const auto& field : schema->fields()) {
+        auto column = delta->GetColumnByName(field->name());
+        if (!column || !column->type()->Equals(field->type())) {
+            throw IOException("Edge column '" + field->name() + "' of the delta chunks does not match the adjacency "
+                              "list");
+        }
+        columns.push_back(std::move(column));
+    }
+    return arrow::Table::Make(schema, columns, delta->num_rows());
+}
+
+void MyAdjReader::BuildIndex(FileSystem& fs, graphar::AdjListType adj_list_type) {
+    GAR_ASSIGN_OR_RAISE_ERROR(auto reader, graphar::AdjListArrowChunkReader::Make(edge_info_, adj_list_type, prefix_));
+    std::vector<std::shared_ptr<arrow::Table>> tables;
+    do {
+        GAR_ASSIGN_OR_RAISE_ERROR(auto table, reader->GetChunk());
+        tables.push_back(std::move(table));
+    } while (reader->next_chunk().ok());
+    std::vector<std::shared_ptr<arrow::Table>> property_tables;
+    for (const auto& pg : property_groups_) {
+        GAR_ASSIGN_OR_RAISE_ERROR(auto property_reader, graphar::AdjListPropertyArrowChunkReader::Make(
+                                                            edge_info_, pg, adj_list_type, prefix_));
+        std::vector<std::shared_ptr<arrow::Table>> chunks;
+        do {
+            GAR_ASSIGN_OR_RAISE_ERROR(auto chunk, property_reader->GetChunk());
+            chunks.push_back(std::move(chunk));
+        } while (property_reader->next_chunk().ok());
+        auto maybe_property_table = arrow::ConcatenateTables(chunks);
+        if (!maybe_property_table.ok()) {
+            throw IOException("Failed to build adjacency index: " + maybe_property_table.status().message());
+        }
+        property_tables.push_back(maybe_property_table.ValueUnsafe());
+    }
+
+    auto maybe_table = arrow::ConcatenateTables(tables);
+    if (!maybe_table.ok()) {
+        throw IOException("Failed to build adjacency index: " + maybe_table.status().message());
+    }
+    auto table = Assemble(maybe_table.ValueUnsafe(), property_tables);
+    auto delta = ReadDelta(fs, table->schema());
+    if (delta) {
+        maybe_table = arrow::ConcatenateTables({table, delta});
+        if (!maybe_table.ok()) {
+            throw IOException("Failed to build adjacency index: " + maybe_table.status().message());
+        }
+        table = maybe_table.ValueUnsafe();
+    }
+    indexed_ = true;
+    if (table->num_rows() == 0) {
+        index_table_ = table;
+        return;
+    }
+    index_table_ = SortByKey(table, by_source_ ? 0 : 1, index_offsets_);
+}
+
+void MyAdjReader::find(graphar::IdType vid) {
+    table_.reset();
+    offset_ = 0;
+    size_ = remaining_ = 0;
+    delta_offset_ = delta_remaining_ = 0;
+    if (vid < 0) {
+        return;
+    }
+    if (indexed_) {
+        if (vid + 1 < static_cast<graphar::IdType>(index_offsets_.size())) {
+            offset_ = index_offsets_[vid];
+            size_ = remaining_ = index_offsets_[vid + 1] - index_offsets_[vid];
+        }
+        return;
+    }
+    FindSorted(vid);
+    // the delta edges of the vertex follow its sorted edges
+    if (vid + 1 < static_cast<graphar::IdType>(delta_offsets_.size())) {
+        delta_offset_ = delta_offsets_[vid];
+        delta_remaining_ = delta_offsets_[vid + 1] - delta_offsets_[vid];
+        size_ += delta_remaining_;
+        remaining_ += delta_remaining_;
+    }
+}
+
+void MyAdjReader::FindSorted(graphar::IdType vid) {
+    auto chunk_and_offset = GetChunkAndOffset(vertex_chunk_size_, vid);
+    if (chunk_and_offset.first >= vertex_chunk_num_) {
+        // vertices added after the adjacency list was written only have delta edges
+        return;
+    }
+    if (chunk_and_offset.first != vertex_chunk_index_) {
+        offsets_ = ReadOffsetChunk(edge_info_, prefix_, adj_list_type_, chunk_and_offset.first);
+        vertex_chunk_index_ = chunk_and_offset.first;
+        auto status = reader_->seek_chunk_index(vertex_chunk_index_);
+        for (idx_t i = 0; status.ok() && i < property_readers_.size(); ++i) {
+            status = property_readers_[i]->seek_chunk_index(vertex_chunk_index_);
+        }
+        if (!status.ok()) {
+            throw IOException("Failed to seek adjacency list: " + status.message());
+        }
+    }
+    if (chunk_and_offset.second + 1 >= offsets_->length()) {
+        return;
+    }
+    const auto begin = offsets_->Value(chunk_and_offset.second);
+    size_ = remaining_ = offsets_->Value(chunk_and_offset.second + 1) - begin;
+    if (remaining_ > 0) {
+        auto status = reader_->seek(begin);
+        for (idx_t i = 0; status.ok() && i < property_readers_.size(); ++i) {
+            status = property_readers_[i]->seek(begin);
+        }
+        if (!status.ok()) {
+            throw IOException("Failed to seek adjacency list: " + status.message());
+        }
+    }
+}
+
+std::shared_ptr<arrow::Table> MyAdjReader::get(int64_t count) {
+    if (remaining_ <= 0) {
+        return GraphArFunctions::EmptyTableFromNamesAndTypes(column_names_, column_types_);
+    }
+    count = std::min(count, remaining_);
+    if (indexed_) {
+        auto result = index_table_->Slice(offset_, count);
+        offset_ += count;
+        remaining_ -= count;
+        return result;
+    }
+    if (remaining_ <= delta_remaining_) {
+        auto result = delta_table_->Slice(delta_offset_, count);
+        delta_offset_ += count;
+        delta_remaining_ -= count;
+        remaining_ -= count;
+        return result;
+    }
+    count = std::min(count, remaining_ - delta_remaining_);
+    if (!table_ || offset_ >= table_->num_rows()) {
+        if (table_) {
+            auto status = reader_->next_chunk();
+            for (idx_t i = 0; status.ok() && i < property_readers_.size(); ++i) {
+                status = property_readers_[i]->next_chunk();
+            }
+            if (!status.ok()) {
+                throw IOException("Failed to read adjacency list: " + status.message());
+            }
+        }
+        GAR_ASSIGN_OR_RAISE_ERROR(auto adj_table, reader_->GetChunk());
+        property_tables_.clear();
+        for (const auto& property_reader : property_readers_) {
+            GAR_ASSIGN_OR_RAISE_ERROR(auto property_table, property_reader->GetChunk());
+            property_tables_.push_back(std::move(property_table));
+        }
+        table_ = Assemble(adj_table, property_tables_);
+        offset_ = 0;
+    }
+    count = std::min(count, table_->num_rows() - offset_);
+    auto result = table_->Slice(offset_, count);
+    offset_ += count;
+    remaining_ -= count;
+    return result;
+}
+
+//-------------------------------------------------------------------
+// MyDirectedAdjReader
+//-------------------------------------------------------------------
+MyDirectedAdjReader::MyDirectedAdjReader(FileSystem& fs, const std::shared_ptr<graphar::EdgeInfo>& edge_info,
+                                         const std::string& prefix, GraphArDirection direction,
+                                         const std::vector<std::string>& edge_properties) {
+    readers_.reserve(2);
+    if (direction != GraphArDirection::In) {
+        readers_.emplace_back(fs, edge_info, prefix, true, edge_properties);
+    }
+    if (direction != GraphArDirection::Out) {
+        readers_.emplace_back(fs, edge_info, prefix, false, edge_properties);
+    }
+}
+
+void MyDirectedAdjReader::find(graphar::IdType vid) {
+    for (auto& reader : readers_) {
+        reader.find(vid);
+    }
+    current_ = 0;
+}
+
+std::shared_ptr<arrow::Table> MyDirectedAdjReader::get(int64_t count) {
+    while (current_ + 1 < readers_.size() && readers_[current_].finish()) {
+        ++current_;
+    }
+    return readers_[current_].get(count);
+}
+
+bool MyDirectedAdjReader::finish() const {
+    return std::all_of(readers_.begin(), readers_.end(), [](const MyAdjReader& reader) { return reader.finish(); });
+}
+
+int64_t MyDirectedAdjReader::size() const {
+    int64_t result = 0;
+    for (const auto& reader : readers_) {
+        result += reader.size();
+    }
+    return result;
+}
+
+//-------------------------------------------------------------------
+// VertexPropertyLookup
+//-------------------------------------------------------------------
+VertexPropertyLookup::VertexPropertyLookup(const std::shared_ptr<graphar::VertexInfo>& vertex_info,
+                                           const std::string& prefix, const std::vector<std::string>& properties)
+    : vertex_info_(vertex_info), prefix_(prefix), properties_(properties) {
+    ResolvePropertyGroups(vertex_info_, properties_, property_groups_, property_group_ids_, &types_);
+    for (const auto& pg : property_groups_) {
+        GAR_ASSIGN_OR_RAISE_ERROR(auto reader,
+                                  graphar::VertexPropertyArrowChunkReader::Make(vertex_info_, pg, prefix_));
+        readers_.push_back(std::move(reader));
+    }
+    chunk_indices_.assign(property_groups_.size(), -1);
+    chunks_.resize(property_groups_.size());
+}
+
+const std::shared_ptr<arrow::Table>& VertexPropertyLookup::GetChunk(idx_t group_id, graphar::IdType chunk_index) {
+    if (chunk_indices_[group_id] != chunk_index) {
+        auto status = readers_[group_id]->seek(chunk_index * vertex_info_->GetChunkSize());
+        if (!status.ok()) {
+            throw IOException("Failed to seek vertex properties: " + status.message());
+        }
+        GAR_ASSIGN_OR_RAISE_ERROR(chunks_[group_id], readers_[group_id]->GetChunk());
+        chunk_indices_[group_id] = chunk_index;
+    }
+    return chunks_[group_id];
+}
+
+std::vector<std::shared_ptr<arrow::Array>> VertexPropertyLookup::Lookup(
+    const std::shared_ptr<arrow::ChunkedArray>& ids) {
+    auto maybe_ids = ids->num_chunks() == 0 ? arrow::MakeEmptyArray(arrow::int64()) : arrow::Concatenate(ids->chunks());
+    if (!maybe_ids.ok()) {
+        throw IOException("Failed to look up vertex properties: " + maybe_ids.status().message());
+    }
+    auto id_array = std::static_pointer_cast<arrow::Int64Array>(maybe_ids.ValueUnsafe());
+    const int64_t rows = id_array->length();
+    const auto chunk_size = vertex_info_->GetChunkSize();
+
+    // Stable order of the rows by vertex chunk, so that each chunk is taken from once
+    std::vector<int64_t> order(rows);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return id_array->Value(a) / chunk_size < id_array->Value(b) / chunk_size;
+    });
+
+    std::vector<std::vector<std::shared_ptr<arrow::Array>>> parts(properties_.size());
+    for (int64_t begin = 0; begin < rows;) {
+        const graphar::IdType chunk_index = id_array->Value(order[begin]) / chunk_size;
+        int64_t end = begin;
+        std::vector<int64_t> positions;
+        while (end < rows && id_array->Value(order[end]) / chunk_size == chunk_index) {
+            positions.push_back(id_array->Value(order[end]) - chunk_index * chunk_size);
+            ++end;
+        }
+        auto indices = std::make_shared<arrow::Int64Array>(positions.size(), arrow::Buffer::Wrap(positions));
+        for (idx_t i = 0; i < properties_.size(); ++i) {
+            auto column = GetChunk(property_group_ids_[i], chunk_index)->GetColumnByName(properties_[i]);
+            if (!column) {
+                throw IOException("Vertex property '" + properties_[i] + "' is missing from its chunk");
+            }
+            auto maybe_taken = arrow::compute::Take(column, indices);
+            if (!maybe_taken.ok()) {
+                throw IOException("Failed to look up vertex properties: " + maybe_taken.status().message());
+            }
+            auto taken = maybe_taken.ValueUnsafe().chunked_array();
+            parts[i].insert(parts[i].end(), taken->chunks().begin(), taken->chunks().end());
+        }
+        begin = end;
+    }
+
+    // Restore the order of ids
+    const bool sorted = std::is_sorted(order.begin(), order.end());
+    std::vector<int64_t> inverse(rows);
+    for (int64_t i = 0; i < rows; ++i) {
+        inverse[order[i]] = i;
+    }
+    auto inverse_indices = std::make_shared<arrow::Int64Array>(rows, arrow::Buffer::Wrap(inverse));
+    std::vector<std::shared_ptr<arrow::Array>> result;
+    for (idx_t i = 0; i < properties_.size(); ++i) {
+        auto maybe_array = parts[i].empty() ? arrow::MakeEmptyArray(GraphArFunctions::graphArT2arrowT(types_[i]))
+                                            : arrow::Concatenate(parts[i]);
+        if (!maybe_array.ok()) {
+            throw IOException("Failed to look up vertex properties: " + maybe_array.status().message());
+        }
+        auto array = maybe_array.ValueUnsafe();
+        if (!sorted) {
+            auto maybe_taken = arrow::compute::Take(*array, *inverse_indices);
+            if (!maybe_taken.ok()) {
+                throw IOException("Failed to look up vertex properties: " + maybe_taken.status().message());
+            }
+            array = maybe_taken.ValueUnsafe();
+        }
+        result.push_back(std::move(array));
+    }
+    return result;
+}
+
 }  // namespace duckdb
@@ -0,0 +1,187 @@
+#include "utils/table_storage_stats.hpp"
+
+#include "utils/edge_delta.hpp"
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/common/file_system.hpp>
+#include <duckdb/common/string_util.hpp>
+#include <duckdb/main/client_context.hpp>
+
+#include <graphar/reader_util.h>
+
+#include <unordered_map>
+
+namespace duckdb {
+
+// Stats of the tables computed by earlier lookups, valid while the count files of a table are unchanged
+class TableStorageStatsCache {
+public:
+    static TableStorageStatsCache& Get() {
+        static TableStorageStatsCache cache;
+        return cache;
+    }
+
+    bool Lookup(const std::string& key, const std::vector<FileStamp>& stamps, TableStorageStats& stats) {
+        lock_guard<mutex> guard(lock);
+        auto it = entries.find(key);
+        if (it == entries.end() || it->second.first != stamps) {
+            return false;
+        }
+        stats = it->second.second;
+        return true;
+    }
+
+    void Store(const std::string& key, const std::vector<FileStamp>& stamps, const TableStorageStats& stats) {
+        lock_guard<mutex> guard(lock);
+        entries[key] = std::make_pair(stamps, stats);
+    }
+
+private:
+    mutex lock;
+    std::unordered_map<std::string, std::pair<std::vector<FileStamp>, TableStorageStats>> entries;
+};
+
+// Stamp of a count file, empty when the file does not exist
+static FileStamp GetCountStamp(ClientContext& context, const std::string& path) {
+    if (!FileSystem::GetFileSystem(context).FileExists(path)) {
+        return FileStamp();
+    }
+    return GetFileStamp(context, path);
+}
+
+static std::string FileTypeName(graphar::FileType file_type) {
+    switch (file_type) {
+        case graphar::FileType::CSV:
+            return "csv";
+        case graphar::FileType::PARQUET:
+            return "parquet";
+        case graphar::FileType::ORC:
+            return "orc";
+        case graphar::FileType::JSON:
+            return "json";
+        default:
+            return "unknown";
+    }
+}
+
+static std::string DescribePropertyGroup(const graphar::PropertyGroup& pg) {
+    vector<string> names;
+    for (const auto& prop : pg.GetProperties()) {
+        names.push_back(prop.name);
+    }
+    return pg.GetPrefix() + " (" + FileTypeName(pg.GetFileType()) + "): " + StringUtil::Join(names, ", ");
+}
+
+// Sizes and chunk files of everything below the directory; offset chunks are not counted as chunks
+static void AddFiles(FileSystem& fs, const std::string& directory, TableStorageStats& stats) {
+    if (!fs.DirectoryExists(directory)) {
+        return;
+    }
+    const bool offsets = StringUtil::EndsWith(directory, "/offset");
+    fs.ListFiles(directory, [&](const string& name, bool is_directory) {
+        const auto path = fs.JoinPath(directory, name);
+        if (is_directory) {
+            AddFiles(fs, path, stats);
+            return;
+        }
+        stats.bytes += fs.OpenFile(path, FileFlags::FILE_FLAGS_READ)->GetFileSize();
+        ++stats.files;
+        if (!offsets && StringUtil::StartsWith(name, "chunk")) {
+            ++stats.chunks;
+        }
+    });
+}
+
+static std::string GetTableDirectory(const std::shared_ptr<graphar::GraphInfo>& graph_info, const std::string& prefix) {
+    auto directory = graph_info->GetPrefix() + prefix;
+    if (StringUtil::EndsWith(directory, "/")) {
+        directory.pop_back();
+    }
+    return directory;
+}
+
+static std::vector<graphar::AdjListType> GetAdjListTypes(const graphar::EdgeInfo& edge_info) {
+    std::vector<graphar::AdjListType> result;
+    for (auto adj_list_type : {graphar::AdjListType::ordered_by_source, graphar::AdjListType::ordered_by_dest,
+                               graphar::AdjListType::unordered_by_source, graphar::AdjListType::unordered_by_dest}) {
+        if (edge_info.HasAdjacentListType(adj_list_type)) {
+            result.push_back(adj_list_type);
+        }
+    }
+    return result;
+}
+
+std::vector<FileStamp> TableStorageStats::GetStamps(ClientContext& context,
+                                                    const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                                    const std::shared_ptr<graphar::VertexInfo>& vertex_info) {
+    GAR_ASSIGN_OR_RAISE_ERROR(auto count_path, vertex_info->GetVerticesNumFilePath());
+    return {GetCountStamp(context, graph_info->GetPrefix() + count_path)};
+}
+
+std::vector<FileStamp> TableStorageStats::GetStamps(ClientContext& context,
+                                                    const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                                    const std::shared_ptr<graphar::EdgeInfo>& edge_info) {
+    const auto& prefix = graph_info->GetPrefix();
+    std::vector<FileStamp> stamps = {GetCountStamp(context, prefix + EdgeDelta::GetCountPath(*edge_info))};
+    for (auto adj_list_type : GetAdjListTypes(*edge_info)) {
+        GAR_ASSIGN_OR_RAISE_ERROR(auto count_path, edge_info->GetVerticesNumFilePath(adj_list_type));
+        stamps.push_back(GetCountStamp(context, prefix + count_path));
+    }
+    return stamps;
+}
+
+TableStorageStats TableStorageStats::Get(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                         const std::shared_ptr<graphar::VertexInfo>& vertex_info) {
+    DUCKDB_GRAPHAR_LOG_TRACE("TableStorageStats::Get vertices");
+    const auto directory = GetTableDirectory(graph_info, vertex_info->GetPrefix());
+    const auto stamps = GetStamps(context, graph_info, vertex_info);
+    TableStorageStats result;
+    if (TableStorageStatsCache::Get().Lookup(directory, stamps, result)) {
+        return result;
+    }
+    AddFiles(FileSystem::GetFileSystem(context), directory, result);
+    result.rows = GraphArFunctions::GetVertexNum(graph_info, vertex_info->GetType());
+    for (const auto& pg : vertex_info->GetPropertyGroups()) {
+        result.layout.push_back(DescribePropertyGroup(*pg));
+    }
+    TableStorageStatsCache::Get().Store(directory, stamps, result);
+    return result;
+}
+
+TableStorageStats TableStorageStats::Get(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                         const std::shared_ptr<graphar::EdgeInfo>& edge_info) {
+    DUCKDB_GRAPHAR_LOG_TRACE("TableStorageStats::Get edges");
+    const auto& prefix = graph_info->GetPrefix();
+    const auto directory = GetTableDirectory(graph_info, edge_info->GetPrefix());
+    const auto adj_list_types = GetAdjListTypes(*edge_info);
+    const auto stamps = GetStamps(context, graph_info, edge_info);
+    TableStorageStats result;
+    if (TableStorageStatsCache::Get().Lookup(directory, stamps, result)) {
+        return result;
+    }
+    AddFiles(FileSystem::GetFileSystem(context), directory, result);
+    if (!adj_list_types.empty()) {
+        // every adjacency list holds all the edges, the first one is counted
+        GAR_ASSIGN_OR_RAISE_ERROR(auto vertex_chunk_num,
+                                  graphar::util::GetVertexChunkNum(prefix, edge_info, adj_list_types[0]));
+        for (graphar::IdType chunk = 0; chunk < vertex_chunk_num; ++chunk) {
+            GAR_ASSIGN_OR_RAISE_ERROR(auto edge_num,
+                                      graphar::util::GetEdgeNum(prefix, edge_info, adj_list_types[0], chunk));
+            result.rows += edge_num;
+        }
+    }
+    result.rows += EdgeDelta::GetRowNum(FileSystem::GetFileSystem(context), prefix, *edge_info);
+    for (auto adj_list_type : adj_list_types) {
+        GAR_ASSIGN_OR_RAISE_ERROR(auto adj_list_prefix, edge_info->GetAdjListPathPrefix(adj_list_type));
+        result.layout.push_back(adj_list_prefix.substr(edge_info->GetPrefix().size()) + " (" +
+                                FileTypeName(edge_info->GetAdjacentList(adj_list_type)->GetFileType()) + ")");
+    }
+    for (const auto& pg : edge_info->GetPropertyGroups()) {
+        result.layout.push_back(DescribePropertyGroup(*pg));
+    }
+    TableStorageStatsCache::Get().Store(directory, stamps, result);
+    return result;
+}
+
+}  // namespace duckdb
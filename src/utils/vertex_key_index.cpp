@@ -0,0 +1,288 @@
+#include "utils/vertex_key_index.hpp"
+
+#include "utils/func.hpp"
+#include "utils/global_log_manager.hpp"
+
+#include <duckdb/common/exception.hpp>
+#include <duckdb/common/types/hash.hpp>
+#include <duckdb/main/client_context.hpp>
+
+#include <graphar/arrow/chunk_reader.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace duckdb {
+
+static constexpr char VERTEX_KEY_INDEX_MAGIC[8] = {'G', 'A', 'R', 'K', 'E', 'Y', '0', '1'};
+static constexpr uint64_t INTEGER_KEY = 1;
+static constexpr uint64_t STRING_HASH_KEY = 2;
+
+struct VertexKeyIndexHeader {
+    char magic[8];
+    uint64_t key_kind;
+    uint64_t vertex_count;
+    uint64_t chunk_size;
+    uint64_t chunk_num;
+    uint64_t entry_count;
+};
+
+struct VertexKeyIndexChunk {
+    // stamp of the chunk of the key property group the keys were read from
+    uint64_t file_size;
+    int64_t last_modified;
+};
+
+struct VertexKeyIndexEntry {
+    int64_t key;
+    int64_t vid;
+
+    bool operator<(const VertexKeyIndexEntry& other) const {
+        return key < other.key || (key == other.key && vid < other.vid);
+    }
+};
+
+static int64_t HashKey(const char* data, idx_t size) { return static_cast<int64_t>(Hash(data, size)); }
+
+static uint64_t GetKeyKind(const std::string& type) {
+    if (type == "int32" || type == "int64") {
+        return INTEGER_KEY;
+    }
+    if (type == "string") {
+        return STRING_HASH_KEY;
+    }
+    throw BinderException("Vertex key indexes support int32, int64 and string keys, not " + type);
+}
+
+// Type of the property in the vertex type, empty when the property does not exist
+static std::string GetPropertyType(const graphar::VertexInfo& vertex_info, const std::string& property) {
+    for (const auto& pg : vertex_info.GetPropertyGroups()) {
+        for (const auto& prop : pg->GetProperties()) {
+            if (prop.name == property) {
+                return prop.type->ToTypeName();
+            }
+        }
+    }
+    return "";
+}
+
+static std::string GetChunkPath(const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                const std::shared_ptr<graphar::VertexInfo>& vertex_info, const std::string& property,
+                                idx_t chunk_index) {
+    GAR_ASSIGN_OR_RAISE_ERROR(auto path,
+                              vertex_info->GetFilePath(vertex_info->GetPropertyGroup(property), chunk_index));
+    return graph_info->GetPrefix() + path;
+}
+
+template <typename ArrayType>
+static void AppendIntegerKeys(const arrow::Array& array, graphar::IdType first_vid,
+                              std::vector<VertexKeyIndexEntry>& entries) {
+    const auto& values = static_cast<const ArrayType&>(array);
+    for (int64_t i = 0; i < values.length(); ++i) {
+        if (!values.IsNull(i)) {
+            entries.push_back({static_cast<int64_t>(values.Value(i)), first_vid + i});
+        }
+    }
+}
+
+template <typename ArrayType>
+static void AppendStringKeys(const arrow::Array& array, graphar::IdType first_vid,
+                             std::vector<VertexKeyIndexEntry>& entries) {
+    const auto& values = static_cast<const ArrayType&>(array);
+    for (int64_t i = 0; i < values.length(); ++i) {
+        if (!values.IsNull(i)) {
+            const auto view = values.GetView(i);
+            entries.push_back({HashKey(view.data(), view.size()), first_vid + i});
+        }
+    }
+}
+
+static void AppendKeys(const arrow::Array& array, graphar::IdType first_vid,
+                       std::vector<VertexKeyIndexEntry>& entries) {
+    switch (array.type_id()) {
+        case arrow::Type::INT32:
+            return AppendIntegerKeys<arrow::Int32Array>(array, first_vid, entries);
+        case arrow::Type::INT64:
+            return AppendIntegerKeys<arrow::Int64Array>(array, first_vid, entries);
+        case arrow::Type::STRING:
+            return AppendStringKeys<arrow::StringArray>(array, first_vid, entries);
+        case arrow::Type::LARGE_STRING:
+            return AppendStringKeys<arrow::LargeStringArray>(array, first_vid, entries);
+        default:
+            throw IOException("Unexpected type " + array.type()->ToString() + " of a vertex key chunk");
+    }
+}
+
+// Path of the index relative to the graph prefix
+static std::string GetRelativePath(const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                   const std::string& vertex_type, const std::string& property) {
+    return graph_info->GetVertexInfo(vertex_type)->GetPrefix() + "key_index/" + property + ".key";
+}
+
+std::string VertexKeyIndex::GetPath(const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                    const std::string& vertex_type, const std::string& property) {
+    return graph_info->GetPrefix() + GetRelativePath(graph_info, vertex_type, property);
+}
+
+std::string VertexKeyIndex::GetPrimaryKey(const graphar::VertexInfo& vertex_info) {
+    for (const auto& pg : vertex_info.GetPropertyGroups()) {
+        for (const auto& prop : pg->GetProperties()) {
+            if (prop.is_primary) {
+                return prop.name;
+            }
+        }
+    }
+    return "";
+}
+
+idx_t VertexKeyIndex::Build(ClientContext& context, const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                            const std::string& vertex_type, const std::string& property,
+                            const std::string& output_prefix) {
+    DUCKDB_GRAPHAR_LOG_TRACE("VertexKeyIndex::Build");
+    auto& fs = FileSystem::GetFileSystem(context);
+    const auto vertex_info = graph_info->GetVertexInfo(vertex_type);
+    const auto path = output_prefix + GetRelativePath(graph_info, vertex_type, property);
+    const auto directory = GetDirectory(path);
+    fs.CreateDirectoriesRecursive(directory);
+
+    VertexKeyIndexHeader header;
+    std::memcpy(header.magic, VERTEX_KEY_INDEX_MAGIC, sizeof(header.magic));
+    header.key_kind = GetKeyKind(GetPropertyType(*vertex_info, property));
+    header.vertex_count = GraphArFunctions::GetVertexNum(graph_info, vertex_type);
+    header.chunk_size = vertex_info->GetChunkSize();
+    header.chunk_num = (header.vertex_count + header.chunk_size - 1) / header.chunk_size;
+    std::vector<VertexKeyIndexChunk> chunks(header.chunk_num);
+
+    GAR_ASSIGN_OR_RAISE_ERROR(auto reader,
+                              graphar::VertexPropertyArrowChunkReader::Make(
+                                  vertex_info, vertex_info->GetPropertyGroup(property), graph_info->GetPrefix()));
+    std::vector<VertexKeyIndexEntry> entries;
+    entries.reserve(header.vertex_count);
+    for (idx_t chunk_index = 0; chunk_index < header.chunk_num; ++chunk_index) {
+        const graphar::IdType begin = chunk_index * header.chunk_size;
+        auto status = reader->seek(begin);
+        if (!status.ok()) {
+            throw IOException("Failed to seek vertex keys: " + status.message());
+        }
+        GAR_ASSIGN_OR_RAISE_ERROR(auto table, reader->GetChunk());
+        auto column = table->GetColumnByName(property);
+        if (!column) {
+            throw IOException("Vertex property '" + property + "' is missing from its chunk");
+        }
+        graphar::IdType vid = begin;
+        for (const auto& array : column->chunks()) {
+            AppendKeys(*array, vid, entries);
+            vid += array->length();
+        }
+        const auto stamp = GetFileStamp(context, GetChunkPath(graph_info, vertex_info, property, chunk_index));
+        chunks[chunk_index].file_size = stamp.size;
+        chunks[chunk_index].last_modified = stamp.last_modified.value;
+    }
+    std::sort(entries.begin(), entries.end());
+    header.entry_count = entries.size();
+
+    // Written to a temporary file first, so that readers never see a partial index
+    const auto tmp_path = path + ".tmp";
+    auto handle = fs.OpenFile(tmp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+    handle->Write(&header, sizeof(header), 0);
+    handle->Write(chunks.data(), chunks.size() * sizeof(VertexKeyIndexChunk), sizeof(header));
+    handle->Write(entries.data(), entries.size() * sizeof(VertexKeyIndexEntry),
+                  sizeof(header) + chunks.size() * sizeof(VertexKeyIndexChunk));
+    handle->Sync();
+    handle->Close();
+    fs.MoveFile(tmp_path, path);
+    DUCKDB_GRAPHAR_LOG_DEBUG("Vertex key index written to " + path);
+    return header.entry_count;
+}
+
+unique_ptr<VertexKeyIndex> VertexKeyIndex::Open(ClientContext& context,
+                                                const std::shared_ptr<graphar::GraphInfo>& graph_info,
+                                                const std::string& vertex_type, const std::string& property) {
+    DUCKDB_GRAPHAR_LOG_TRACE("VertexKeyIndex::Open");
+    auto& fs = FileSystem::GetFileSystem(context);
+    const auto path = GetPath(graph_info, vertex_type, property);
+    if (!fs.FileExists(path)) {
+        return nullptr;
+    }
+    const auto vertex_info = graph_info->GetVertexInfo(vertex_type);
+    auto result = make_uniq<VertexKeyIndex>();
+    result->handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+
+    VertexKeyIndexHeader header;
+    if (result->handle->GetFileSize() < sizeof(header)) {
+        return nullptr;
+    }
+    result->handle->Read(&header, sizeof(header), 0);
+    if (std::memcmp(header.magic, VERTEX_KEY_INDEX_MAGIC, sizeof(header.magic)) != 0 ||
+        header.chunk_size != static_cast<uint64_t>(vertex_info->GetChunkSize()) ||
+        header.vertex_count != static_cast<uint64_t>(GraphArFunctions::GetVertexNum(graph_info, vertex_type))) {
+        DUCKDB_GRAPHAR_LOG_DEBUG("Vertex key index " + path + " does not match the graph");
+        return nullptr;
+    }
+    std::vector<VertexKeyIndexChunk> chunks(header.chunk_num);
+    result->data_offset = sizeof(header) + chunks.size() * sizeof(VertexKeyIndexChunk);
+    if (result->handle->GetFileSize() != result->data_offset + header.entry_count * sizeof(VertexKeyIndexEntry)) {
+        return nullptr;
+    }
+    result->handle->Read(chunks.data(), chunks.size() * sizeof(VertexKeyIndexChunk), sizeof(header));
+    for (idx_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index) {
+        const auto stamp = GetFileStamp(context, GetChunkPath(graph_info, vertex_info, property, chunk_index));
+        if (stamp.size != chunks[chunk_index].file_size ||
+            stamp.last_modified.value != chunks[chunk_index].last_modified) {
+            DUCKDB_GRAPHAR_LOG_DEBUG("Vertex key index " + path + " is stale");
+            return nullptr;
+        }
+    }
+    result->key_kind = header.key_kind;
+    result->entry_count = header.entry_count;
+    return result;
+}
+
+int64_t VertexKeyIndex::ReadKey(idx_t entry) const {
+    int64_t key;
+    handle->Read(&key, sizeof(key), data_offset + entry * sizeof(VertexKeyIndexEntry));
+    return key;
+}
+
+std::vector<graphar::IdType> VertexKeyIndex::Lookup(const Value& value, idx_t max_count) const {
+    std::vector<graphar::IdType> result;
+    if (value.IsNull()) {
+        return result;
+    }
+    Value key_value;
+    string error;
+    const auto key_type = key_kind == INTEGER_KEY ? LogicalType::BIGINT : LogicalType::VARCHAR;
+    if (!value.DefaultTryCastAs(key_type, key_value, &error)) {
+        return result;
+    }
+    int64_t key;
+    if (key_kind == INTEGER_KEY) {
+        key = key_value.GetValue<int64_t>();
+    } else {
+        const auto& str = StringValue::Get(key_value);
+        key = HashKey(str.data(), str.size());
+    }
+
+    // binary search for the first entry of the key, reading one key per step
+    idx_t begin = 0;
+    idx_t end = entry_count;
+    while (begin < end) {
+        const idx_t middle = begin + (end - begin) / 2;
+        if (ReadKey(middle) < key) {
+            begin = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+    for (idx_t entry = begin; entry < entry_count && result.size() < max_count; ++entry) {
+        VertexKeyIndexEntry index_entry;
+        handle->Read(&index_entry, sizeof(index_entry), data_offset + entry * sizeof(VertexKeyIndexEntry));
+        if (index_entry.key != key) {
+            break;
+        }
+        result.push_back(index_entry.vid);
+    }
+    return result;
+}
+
+}  // namespace duckdb